@@ -0,0 +1,41 @@
+/**
+* @file alloc_bench.cpp
+* @brief push_back throughput of List_ with the default allocator vs pmr resources
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <memory_resource>
+
+auto main() -> int
+{
+  constexpr std::size_t n    = 1'000'000;
+  constexpr std::size_t reps = 5;
+
+  const double def = bench::best_ms(reps, [] {
+    List_<int> l;
+    for (std::size_t i = 0; i < n; ++i) { l.push_back(static_cast<int>(i)); }
+    bench::do_not_optimize(l.size());
+  });
+
+  const double pool = bench::best_ms(reps, [] {
+    std::pmr::unsynchronized_pool_resource res;
+    pmr::List_<int> l(&res);
+    for (std::size_t i = 0; i < n; ++i) { l.push_back(static_cast<int>(i)); }
+    bench::do_not_optimize(l.size());
+  });
+
+  const double mono = bench::best_ms(reps, [] {
+    std::pmr::monotonic_buffer_resource res;
+    pmr::List_<int> l(&res);
+    for (std::size_t i = 0; i < n; ++i) { l.push_back(static_cast<int>(i)); }
+    bench::do_not_optimize(l.size());
+  });
+
+  std::printf("push_back x %zu (best of %zu, includes teardown)\n", n, reps);
+  std::printf("  std::allocator                    : %8.2f ms\n", def);
+  std::printf("  pmr::unsynchronized_pool_resource : %8.2f ms\n", pool);
+  std::printf("  pmr::monotonic_buffer_resource    : %8.2f ms\n", mono);
+}
@@ -0,0 +1,77 @@
+/**
+* @file bench.hpp
+* @brief tiny timing helpers shared by the benchmarks
+*/
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace bench {
+
+  /* keeps the compiler from optimizing away `value` */
+  template <typename T>
+  inline auto do_not_optimize(T const& value) -> void
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  /**
+  * @brief runs `fn` `reps` times and returns the best wall time in milliseconds
+  * @param reps
+  * @param fn
+  */
+  template <typename Fn>
+  auto best_ms(const std::size_t reps, Fn&& fn) -> double
+  {
+    double best = {};
+    for (std::size_t r = 0; r < reps; ++r) {
+      const auto start = std::chrono::steady_clock::now();
+      fn();
+      const auto stop  = std::chrono::steady_clock::now();
+      const double ms  = std::chrono::duration<double, std::milli>(stop - start).count();
+      if (r == 0 || ms < best) { best = ms; }
+    }
+    return best;
+  }
+
+  /* totals of every counting_allocator instantiation */
+  struct alloc_stats {
+    static inline std::size_t calls = {};
+    static inline std::size_t bytes = {};
+    static inline std::size_t frees = {}; // deallocate() calls
+    static auto reset() noexcept -> void { calls = {}; bytes = {}; frees = {}; }
+  };
+
+  /* stateless std::allocator replacement that records what it hands out */
+  template <typename T>
+  struct counting_allocator {
+    using value_type = T;
+    //
+    counting_allocator() noexcept = default;
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+    //
+    auto allocate(const std::size_t n) -> T*
+    {
+      ++alloc_stats::calls;
+      alloc_stats::bytes += n * sizeof(T);
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    auto deallocate(T* p, const std::size_t n) noexcept -> void
+    {
+      ++alloc_stats::frees;
+      ::operator delete(p, n * sizeof(T));
+    }
+    //
+    template <typename U>
+    friend auto operator==(const counting_allocator&, const counting_allocator<U>&) noexcept -> bool { return true; }
+  };
+
+} // namespace bench
+
+#endif // BENCH_HPP
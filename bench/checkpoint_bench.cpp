@@ -0,0 +1,65 @@
+/**
+* @file checkpoint_bench.cpp
+* @brief random positional access and edits on long lists: the linear walk from the
+*        head vs List_::use_checkpoints()
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t walk_budget = 100'000'000; // nodes walked per size without checkpoints
+
+  auto make_list(const std::size_t n, const bool checkpoints) -> List_<long>
+  {
+    List_<long> list;
+    for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<long>(i)); }
+    if (checkpoints) { list.use_checkpoints(); }
+    return list;
+  }
+
+  struct timings {
+    double at;
+    double edit; // a push_at and a pop_at at independent random positions
+  };
+
+  auto run(const std::size_t n, const bool checkpoints, const std::size_t ops) -> timings
+  {
+    auto list = make_list(n, checkpoints);
+    std::mt19937_64 rng(n);
+    std::vector<std::size_t> pos(ops);
+    for (auto& p : pos) { p = rng() % n; }
+    long sum = {};
+    const double at = bench::best_ms(1, [&] {
+      for (const auto p : pos) { sum += list.at(p); }
+    });
+    bench::do_not_optimize(sum);
+    const double edit = bench::best_ms(1, [&] {
+      for (std::size_t i = 0; i < ops; ++i) {
+        list.push_at(pos[i], -1);
+        list.pop_at(pos[ops - 1 - i]);
+      }
+    });
+    const double to_ns = 1e6 / static_cast<double>(ops);
+    return {at * to_ns, edit * to_ns};
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("n,op,linear_ns,checkpoints_ns\n");
+  for (const std::size_t n : {10'000UL, 100'000UL, 1'000'000UL}) {
+    const std::size_t linear_ops = std::clamp<std::size_t>(walk_budget / n, 100, 10'000);
+    const timings linear = run(n, false, linear_ops);
+    const timings index  = run(n, true, 100'000);
+    std::printf("%zu,at,%.1f,%.1f\n", n, linear.at, index.at);
+    std::printf("%zu,push_at+pop_at,%.1f,%.1f\n", n, linear.edit, index.edit);
+  }
+}
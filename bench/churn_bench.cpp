@@ -0,0 +1,53 @@
+/**
+* @file churn_bench.cpp
+* @brief queue style churn, pop_front() then push_back() on a List_ of steady size,
+*        with and without recycle_nodes(), and how often the allocator is called
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+  constexpr std::size_t length = 1'000;       // elements kept in the queue
+  constexpr std::size_t churns = 10'000'000;  // pop_front + push_back pairs
+
+  template <typename T>
+  using counted_list = List_<T, bench::counting_allocator<T>>;
+
+  template <typename T, typename Make>
+  auto report(const char* type, const std::size_t spares, Make make) -> void
+  {
+    counted_list<T> queue;
+    queue.recycle_nodes(spares);
+    for (std::size_t i = 0; i < length; ++i) { queue.push_back(make(i)); }
+    //
+    std::size_t calls = {};
+    const double ms = bench::best_ms(3, [&] {
+      bench::alloc_stats::reset();
+      for (std::size_t i = 0; i < churns; ++i) {
+        queue.pop_front();
+        queue.push_back(make(i));
+      }
+      calls = bench::alloc_stats::calls;
+      bench::do_not_optimize(queue.front());
+    });
+    std::printf("%s,%zu,%.1f,%zu\n", type, spares, ms * 1e6 / static_cast<double>(churns), calls);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu pop_front + push_back pairs on a queue of %zu\n", churns, length);
+  std::printf("type,max_spares,ns_per_pair,allocations\n");
+  for (const std::size_t spares : {0, 1, 64}) {
+    report<int>("int", spares, [](const std::size_t i) { return static_cast<int>(i); });
+  }
+  for (const std::size_t spares : {0, 1, 64}) {
+    report<std::string>("string", spares, [](const std::size_t i) { return std::to_string(i); });
+  }
+}
@@ -0,0 +1,82 @@
+/**
+* @file compact_bench.cpp
+* @brief memory and traversal of up to 10M ints in List_ ( pointer links, one allocation per
+*        node ) vs CompactList_ ( 32-bit slot links in slab arrays ), in build order and
+*        after sorting random values, which scatters the links over the nodes
+*/
+
+#include "bench.hpp"
+#include "compact_list.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+
+  /* resident set size of this process in KiB */
+  auto rss_kib() -> std::size_t
+  {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line); ) {
+      if (line.rfind("VmRSS:", 0) == 0) { return std::stoul(line.substr(6)); }
+    }
+    return 0;
+  }
+
+  /* runs `fn` in a child process so the RSS of one layout is not recycled by the next */
+  template <typename Fn>
+  auto isolated(Fn&& fn) -> void
+  {
+    std::fflush(stdout);
+    if (const pid_t pid = fork(); pid == 0) { fn(); std::fflush(stdout); _exit(0); }
+    else if (pid > 0) { waitpid(pid, nullptr, 0); }
+  }
+
+  template <typename List>
+  auto traverse_ms(const List& list) -> double
+  {
+    return bench::best_ms(5, [&] {
+      long long sum = {};
+      for (const int i : list) { sum += i; }
+      bench::do_not_optimize(sum);
+    });
+  }
+
+  template <typename List>
+  auto report(const char* name, const std::size_t n) -> void
+  {
+    isolated([name, n] {
+      bench::alloc_stats::reset();
+      const std::size_t before = rss_kib();
+      List list;
+      std::mt19937 rng(42);
+      for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<int>(rng())); }
+      const std::size_t rss = rss_kib() - before;
+      const double in_order = traverse_ms(list);
+      list.sort();
+      const double sorted = traverse_ms(list);
+      std::printf("%s,%zu,%zu,%.1f,%.1f,%.2f,%.2f\n", name, n, bench::alloc_stats::calls,
+                  static_cast<double>(bench::alloc_stats::bytes) / n,
+                  static_cast<double>(rss) * 1024 / n,
+                  in_order * 1e6 / static_cast<double>(n), sorted * 1e6 / static_cast<double>(n));
+    });
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("random ints, push_back then sort()\n");
+  std::printf("list,n,allocations,requested_B_per_elem,rss_B_per_elem,traverse_ns_per_elem,traverse_sorted_ns_per_elem\n");
+  for (const std::size_t n : {100'000, 1'000'000, 10'000'000}) {
+    report<List_<int, bench::counting_allocator<int>>>("List_", n);
+    report<CompactList_<int, bench::counting_allocator<int>>>("CompactList_", n);
+  }
+}
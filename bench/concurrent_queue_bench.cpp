@@ -0,0 +1,98 @@
+/**
+* @file concurrent_queue_bench.cpp
+* @brief producer/consumer throughput: List_ behind one mutex vs the lock-free
+*        ConcurrentQueue_, at varying producer and consumer counts
+*/
+
+#include "bench.hpp"
+#include "concurrent_queue.hpp"
+#include "list.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t items = 1'000'000; // per configuration, split over the producers
+
+  /* the work queue as it is used today: a List_ and a global mutex */
+  class locked_queue {
+  private:
+    std::mutex  m_lock;
+    List_<long> m_list;
+    //
+  public:
+    auto try_push(const long value) -> bool
+    {
+      std::lock_guard lock(m_lock);
+      m_list.push_back(value);
+      return true;
+    }
+    auto try_pop(long& out) -> bool
+    {
+      std::lock_guard lock(m_lock);
+      if (m_list.is_empty()) { return false; }
+      out = m_list.front();
+      m_list.pop_front();
+      return true;
+    }
+  };
+
+  /* wall time for `producers` threads to push `items` values and `consumers` to pop them all */
+  template <typename Queue>
+  auto run(const std::size_t producers, const std::size_t consumers) -> double
+  {
+    Queue queue;
+    std::atomic<std::size_t> popped = {};
+    std::atomic<long long>   total  = {};
+    std::atomic<bool>        go     = {false};
+    //
+    const double ms = bench::best_ms(1, [&] {
+      std::vector<std::jthread> threads;
+      for (std::size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          for (std::size_t i = p; i < items; i += producers) {
+            while (!queue.try_push(static_cast<long>(i))) { std::this_thread::yield(); }
+          }
+        });
+      }
+      for (std::size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          long long sum   = {};
+          long      value = {};
+          while (popped.load(std::memory_order_relaxed) < items) {
+            if (queue.try_pop(value)) { sum += value; popped.fetch_add(1, std::memory_order_relaxed); }
+            else                      { std::this_thread::yield(); }
+          }
+          total.fetch_add(sum, std::memory_order_relaxed);
+        });
+      }
+      go.store(true, std::memory_order_release);
+    });
+    //
+    const long long expected = static_cast<long long>(items) * (items - 1) / 2;
+    if (total.load() != expected) { std::fprintf(stderr, "- lost or duplicated elements\n"); }
+    return ms;
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  constexpr std::pair<std::size_t, std::size_t> configs[] = {
+    {1, 1}, {2, 2}, {4, 4}, {8, 8}, {16, 16}, {16, 1}, {1, 16}, {16, 4},
+  };
+  std::printf("%zu items, %u hardware threads\n", items, std::thread::hardware_concurrency());
+  std::printf("producers,consumers,mutex_list_mops,concurrent_queue_mops\n");
+  for (const auto& [producers, consumers] : configs) {
+    const double locked   = run<locked_queue>(producers, consumers);
+    const double lockfree = run<ConcurrentQueue_<long>>(producers, consumers);
+    std::printf("%zu,%zu,%.2f,%.2f\n", producers, consumers, items / locked / 1e3, items / lockfree / 1e3);
+  }
+}
@@ -0,0 +1,103 @@
+/**
+* @file concurrent_set_bench.cpp
+* @brief mixed search/insert/erase on one shared sorted list from 1 to 32 threads:
+*        List_ behind one mutex vs the lock-free ConcurrentSet_
+*/
+
+#include "bench.hpp"
+#include "concurrent_set.hpp"
+#include "list.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t ops   = 400'000; // per configuration, split over the threads
+  constexpr int         range = 1024;    // keys, about half of them present
+
+  /* a sorted List_ and a global mutex: search, ordered push_at, pop_at */
+  class locked_set {
+  private:
+    std::mutex m_lock;
+    List_<int> m_list;
+    //
+    /* position of the first element not less than `key` */
+    auto lower_bound(const int key) const -> std::size_t
+    {
+      std::size_t pos = 0;
+      for (const int i : m_list) { if (i >= key) { break; } ++pos; }
+      return pos;
+    }
+    //
+  public:
+    auto contains(const int key) -> bool
+    {
+      std::lock_guard lock(m_lock);
+      return !m_list.is_empty() && m_list.search(key);
+    }
+    auto insert(const int key) -> bool
+    {
+      std::lock_guard lock(m_lock);
+      const std::size_t pos = lower_bound(key);
+      if (pos < m_list.size() && m_list.at(pos) == key) { return false; }
+      m_list.push_at(pos, key);
+      return true;
+    }
+    auto erase(const int key) -> bool
+    {
+      std::lock_guard lock(m_lock);
+      const std::size_t pos = lower_bound(key);
+      if (pos == m_list.size() || m_list.at(pos) != key) { return false; }
+      m_list.pop_at(pos);
+      return true;
+    }
+  };
+
+  /* wall time for `threads` threads doing `ops` operations, `reads` percent of them lookups */
+  template <typename Set>
+  auto run(const std::size_t threads, const unsigned reads) -> double
+  {
+    Set set;
+    for (int k = 0; k < range; k += 2) { set.insert(k); }
+    std::atomic<bool> go = {false};
+    //
+    return bench::best_ms(1, [&] {
+      std::vector<std::jthread> workers;
+      for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          std::mt19937 rng(static_cast<unsigned>(t) + 1);
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          std::size_t hits = {};
+          for (std::size_t i = t; i < ops; i += threads) {
+            const int      key  = static_cast<int>(rng() % range);
+            const unsigned roll = rng() % 100;
+            if      (roll < reads)                   { hits += set.contains(key); }
+            else if (roll < reads + (100 - reads) / 2) { hits += set.insert(key); }
+            else                                     { hits += set.erase(key); }
+          }
+          bench::do_not_optimize(hits);
+        });
+      }
+      go.store(true, std::memory_order_release);
+    });
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu ops over %d keys, %u hardware threads\n", ops, range, std::thread::hardware_concurrency());
+  std::printf("threads,read_pct,mutex_list_mops,concurrent_set_mops\n");
+  for (const unsigned reads : {90U, 50U}) {
+    for (const std::size_t threads : {1, 2, 4, 8, 16, 32}) {
+      const double locked   = run<locked_set>(threads, reads);
+      const double lockfree = run<ConcurrentSet_<int>>(threads, reads);
+      std::printf("%zu,%u,%.2f,%.2f\n", threads, reads, ops / locked / 1e3, ops / lockfree / 1e3);
+    }
+  }
+}
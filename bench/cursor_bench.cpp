@@ -0,0 +1,75 @@
+/**
+* @file cursor_bench.cpp
+* @brief index based loops over List_: ascending positions resume from the cursor,
+*        descending ones restart from the head every call as all of them used to
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+
+namespace {
+
+  auto make_list(const std::size_t n) -> List_<long>
+  {
+    List_<long> list;
+    for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<long>(i)); }
+    return list;
+  }
+
+  constexpr std::size_t max_descending = 10'000; // quadratic, larger lists take minutes
+
+  auto per_step_ns(const double ms, const std::size_t steps) -> double
+  {
+    return ms * 1e6 / static_cast<double>(steps);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("n,loop,ascending_ns_per_step,descending_ns_per_step\n");
+  for (const std::size_t n : {1'000UL, 10'000UL, 100'000UL, 1'000'000UL}) {
+    auto list = make_list(n);
+    long sum = {};
+    // for i in 0..n: list.at(i)
+    const double up = bench::best_ms(3, [&] {
+      for (std::size_t i = 0; i < n; ++i) { sum += list.at(i); }
+    });
+    bench::do_not_optimize(sum);
+    if (n <= max_descending) {
+      const double down = bench::best_ms(1, [&] {
+        for (std::size_t i = n; i-- > 0; ) { sum += list.at(i); }
+      });
+      bench::do_not_optimize(sum);
+      std::printf("%zu,at,%.1f,%.1f\n", n, per_step_ns(up, n), per_step_ns(down, n));
+    } else {
+      std::printf("%zu,at,%.1f,-\n", n, per_step_ns(up, n));
+    }
+    //
+    // insert after every element, then remove them again: the list doubles and shrinks back
+    const double grow_up = bench::best_ms(1, [&] {
+      for (std::size_t i = 0; i < n; ++i) { list.push_at(2 * i + 1, -1); }
+    });
+    const double shrink_up = bench::best_ms(1, [&] {
+      for (std::size_t i = 0; i < n; ++i) { list.pop_at(i + 1); }
+    });
+    if (n <= max_descending) {
+      const double grow_down = bench::best_ms(1, [&] {
+        for (std::size_t i = n; i-- > 0; ) { list.push_at(i + 1, -1); }
+      });
+      const double shrink_down = bench::best_ms(1, [&] {
+        for (std::size_t i = n; i-- > 0; ) { list.pop_at(2 * i + 1); }
+      });
+      std::printf("%zu,push_at,%.1f,%.1f\n", n, per_step_ns(grow_up, n), per_step_ns(grow_down, n));
+      std::printf("%zu,pop_at,%.1f,%.1f\n", n, per_step_ns(shrink_up, n), per_step_ns(shrink_down, n));
+    } else {
+      std::printf("%zu,push_at,%.1f,-\n", n, per_step_ns(grow_up, n));
+      std::printf("%zu,pop_at,%.1f,-\n", n, per_step_ns(shrink_up, n));
+    }
+    //
+    std::size_t i = 0;
+    for (const long v : list) { if (v != static_cast<long>(i++)) { std::printf("- mismatch at %zu\n", i - 1); return 1; } }
+  }
+}
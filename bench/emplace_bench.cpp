@@ -0,0 +1,81 @@
+/**
+* @file emplace_bench.cpp
+* @brief building a List_ of heap strings and of large records: push_back copying an
+*        lvalue, push_back moving an rvalue and emplace_back from constructor arguments
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <array>
+#include <cstdio>
+#include <list>
+#include <string>
+
+namespace {
+
+  constexpr std::size_t count = 1'000'000;
+
+  /* 256 byte payload, built from an id */
+  struct record {
+    std::array<char, 248> m_blob = {};
+    std::size_t           m_id   = {};
+    //
+    record() = default;
+    explicit record(const std::size_t id) : m_id(id) { m_blob.fill(static_cast<char>(id)); }
+  };
+
+  /* long enough to live on the heap */
+  auto make_string(const std::size_t i) -> std::string
+  {
+    return std::string(240, 'x') + std::to_string(i);
+  }
+
+  template <typename T, typename Fill>
+  auto ns_per_insert(Fill fill) -> double
+  {
+    const double ms = bench::best_ms(3, [&] {
+      List_<T> list;
+      fill(list);
+      bench::do_not_optimize(list.size());
+    });
+    return ms * 1e6 / static_cast<double>(count);
+  }
+
+  template <typename T, typename Make, typename Build>
+  auto report(const char* name, Make make, Build build) -> void
+  {
+    struct copy_fill {
+      Make make;
+      auto operator()(List_<T>& l) const -> void { for (std::size_t i = 0; i < count; ++i) { const T v = make(i); l.push_back(v); } }
+    };
+    struct move_fill {
+      Make make;
+      auto operator()(List_<T>& l) const -> void { for (std::size_t i = 0; i < count; ++i) { l.push_back(make(i)); } }
+    };
+    struct emplace_fill {
+      Build build;
+      auto operator()(List_<T>& l) const -> void { for (std::size_t i = 0; i < count; ++i) { build(l, i); } }
+    };
+    const double std_list = bench::best_ms(3, [&] {
+      std::list<T> list;
+      for (std::size_t i = 0; i < count; ++i) { list.push_back(make(i)); }
+      bench::do_not_optimize(list.size());
+    }) * 1e6 / static_cast<double>(count);
+    std::printf("%s,%.1f,%.1f,%.1f,%.1f\n", name, ns_per_insert<T>(copy_fill{make}), ns_per_insert<T>(move_fill{make}),
+                ns_per_insert<T>(emplace_fill{build}), std_list);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu inserts, ns per insert\n", count);
+  std::printf("payload,push_back(const T&),push_back(T&&),emplace_back,std::list::push_back(T&&)\n");
+  report<record>("record ( 256 B )",
+                 [](const std::size_t i) { return record(i); },
+                 [](List_<record>& l, const std::size_t i) { l.emplace_back(i); });
+  report<std::string>("std::string",
+                      [](const std::size_t i) { return make_string(i); },
+                      [](List_<std::string>& l, const std::size_t i) { l.emplace_back(240, 'x') += std::to_string(i); });
+}
@@ -0,0 +1,82 @@
+/**
+* @file footprint_bench.cpp
+* @brief memory footprint of a 10M element List_<int>, single-owner nodes vs the
+*        former shared_ptr linked layout (reproduced here as `shared_node`)
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+  /* resident set size of this process in KiB */
+  auto rss_kib() -> std::size_t
+  {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line); ) {
+      if (line.rfind("VmRSS:", 0) == 0) { return std::stoul(line.substr(6)); }
+    }
+    return 0;
+  }
+
+  /* node layout List_ used before: payload + shared_ptr link, made by allocate_shared */
+  struct shared_node {
+    int                          m_data = {};
+    std::shared_ptr<shared_node> m_next = {nullptr};
+  };
+
+  constexpr std::size_t n = 10'000'000;
+
+  /* runs `fn` in a child process so the RSS of one layout is not recycled by the next */
+  template <typename Fn>
+  auto isolated(Fn&& fn) -> void
+  {
+    std::fflush(stdout);
+    if (const pid_t pid = fork(); pid == 0) { fn(); std::fflush(stdout); _exit(0); }
+    else if (pid > 0) { waitpid(pid, nullptr, 0); }
+  }
+
+  auto report(const char* name, const std::size_t rss_before) -> void
+  {
+    const std::size_t rss = rss_kib() - rss_before;
+    std::printf("%-22s allocs=%9zu  requested=%7.1f MiB (%5.1f B/elem)  rss=+%7.1f MiB (%5.1f B/elem)\n",
+                name, bench::alloc_stats::calls,
+                static_cast<double>(bench::alloc_stats::bytes) / (1 << 20),
+                static_cast<double>(bench::alloc_stats::bytes) / n,
+                static_cast<double>(rss) / 1024,
+                static_cast<double>(rss) * 1024 / n);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  isolated([] {
+    bench::alloc_stats::reset();
+    const std::size_t before = rss_kib();
+    std::shared_ptr<shared_node> head = std::allocate_shared<shared_node>(bench::counting_allocator<shared_node>());
+    shared_node* tail = head.get();
+    for (std::size_t i = 1; i < n; ++i) {
+      tail->m_next = std::allocate_shared<shared_node>(bench::counting_allocator<shared_node>());
+      tail = tail->m_next.get();
+      tail->m_data = static_cast<int>(i);
+    }
+    report("shared_ptr (before)", before);
+    while (head) { head = std::move(head->m_next); } // unlink iteratively, no deep recursion
+  });
+  isolated([] {
+    bench::alloc_stats::reset();
+    const std::size_t before = rss_kib();
+    List_<int, bench::counting_allocator<int>> l;
+    for (std::size_t i = 0; i < n; ++i) { l.push_back(static_cast<int>(i)); }
+    report("single owner (after)", before);
+  });
+}
@@ -0,0 +1,136 @@
+/**
+* @file huge_page_bench.cpp
+* @brief traversal of a large List_ whose links were scattered by sort(): nodes from the
+*        default allocate_node() path vs from a pool over huge_page_resource, with dTLB
+*        load misses from perf counters where the kernel exposes them
+*/
+
+#include "bench.hpp"
+#include "huge_page_resource.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory_resource>
+#include <random>
+#include <string>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+  /* dTLB read misses of this thread in user space, invalid when perf events are unavailable */
+  class tlb_counter {
+  private:
+    int m_fd = -1;
+    //
+  public:
+    tlb_counter()
+    {
+      perf_event_attr attr = {};
+      attr.type           = PERF_TYPE_HW_CACHE;
+      attr.size           = sizeof(attr);
+      attr.config         = PERF_COUNT_HW_CACHE_DTLB
+                          | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                          | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    tlb_counter(const tlb_counter&) = delete;
+    tlb_counter& operator=(const tlb_counter&) = delete;
+    ~tlb_counter() { if (m_fd >= 0) { close(m_fd); } }
+    //
+    [[nodiscard]] auto valid() const noexcept -> bool { return m_fd >= 0; }
+    auto start() -> void
+    {
+      if (!valid()) { return; }
+      ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    auto stop() -> long long
+    {
+      if (!valid()) { return -1; }
+      ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+      long long count = {};
+      if (read(m_fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) { return -1; }
+      return count;
+    }
+  };
+
+  /* AnonHugePages of this process in KiB, huge pages the kernel actually handed out */
+  auto anon_huge_kib() -> std::size_t
+  {
+    std::ifstream rollup("/proc/self/smaps_rollup");
+    for (std::string line; std::getline(rollup, line); ) {
+      if (line.rfind("AnonHugePages:", 0) == 0) { return std::stoul(line.substr(14)); }
+    }
+    return 0;
+  }
+
+  /* runs `fn` in a child process so one layout's pages are not recycled by the next */
+  template <typename Fn>
+  auto isolated(Fn&& fn) -> void
+  {
+    std::fflush(stdout);
+    if (const pid_t pid = fork(); pid == 0) { fn(); std::fflush(stdout); _exit(0); }
+    else if (pid > 0) { waitpid(pid, nullptr, 0); }
+  }
+
+  /* fills `list` with random values and sorts it, so consecutive nodes sit far apart */
+  template <typename List>
+  auto measure(const char* name, List& list, const std::size_t n) -> void
+  {
+    std::mt19937_64 rng(42);
+    for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<long>(rng())); }
+    list.sort();
+    //
+    tlb_counter tlb;
+    long long misses = -1;
+    const double ms = bench::best_ms(3, [&] {
+      tlb.start();
+      long seen = {};
+      for (const long i : list) { seen ^= i; }
+      bench::do_not_optimize(seen);
+      misses = tlb.stop();
+    });
+    if (misses >= 0) {
+      std::printf("%s,%.1f,%.2f,%lld,%.3f,%zu\n", name, ms, ms * 1e6 / static_cast<double>(n),
+                  misses, static_cast<double>(misses) / static_cast<double>(n), anon_huge_kib() >> 10);
+    } else {
+      std::printf("%s,%.1f,%.2f,n/a,n/a,%zu\n", name, ms, ms * 1e6 / static_cast<double>(n), anon_huge_kib() >> 10);
+    }
+  }
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+  const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+  std::printf("%zu random longs, push_back then sort(), best of 3 traversals\n", n);
+  std::printf("nodes,traverse_ms,ns_per_elem,dtlb_misses,dtlb_misses_per_elem,anon_huge_MiB\n");
+  isolated([n] {
+    List_<long> list;
+    measure("allocate_node()", list, n);
+  });
+  isolated([n] {
+    std::pmr::unsynchronized_pool_resource pool(std::pmr::new_delete_resource());
+    pmr::List_<long> list(&pool);
+    measure("pool/new_delete", list, n);
+  });
+  isolated([n] {
+    huge_page_resource huge;
+    std::pmr::unsynchronized_pool_resource pool(&huge);
+    {
+      pmr::List_<long> list(&pool);
+      measure("pool/huge_page", list, n);
+    }
+    std::printf("# huge_page_resource: %zu MiB mapped, %zu MiB advised\n", huge.mapped_bytes() >> 20, huge.advised_bytes() >> 20);
+  });
+}
@@ -0,0 +1,86 @@
+/**
+* @file index_bench.cpp
+* @brief search()/locate() on 100k+ distinct keys: List_ linear scans vs IndexedList_,
+*        plus what the index costs on push/pop and in memory
+*/
+
+#include "bench.hpp"
+#include "indexed_list.hpp"
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t scan_budget   = 200'000'000; // elements visited by List_ scans per size
+  constexpr std::size_t index_queries = 2'000'000;
+
+  /* keys 0 .. n-1 in random order, and random lookups half of which miss */
+  auto make_keys(const std::size_t n, std::mt19937& rng) -> std::vector<int>
+  {
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+  }
+
+  auto make_queries(const std::size_t n, const std::size_t count, std::mt19937& rng) -> std::vector<int>
+  {
+    std::vector<int> q(count);
+    for (auto& i : q) { i = static_cast<int>(rng() % (2 * n)); }
+    return q;
+  }
+
+  template <typename List, typename Op>
+  auto per_query_ns(List& list, const std::vector<int>& queries, Op op) -> double
+  {
+    long long found = {};
+    const double ms = bench::best_ms(3, [&] {
+      for (const int q : queries) { found += op(list, q); }
+    });
+    bench::do_not_optimize(found);
+    return ms * 1e6 / static_cast<double>(queries.size());
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::mt19937 rng(42);
+  std::printf("n,op,list_ns,indexed_ns\n");
+  for (const std::size_t n : {1'000UL, 100'000UL, 1'000'000UL}) {
+    const auto keys = make_keys(n, rng);
+    List_<int> plain;
+    IndexedList_<int> indexed;
+    for (const int k : keys) { plain.push_back(k); indexed.push_back(k); }
+    const auto few  = make_queries(n, std::clamp<std::size_t>(scan_budget / n, 20, 2'000), rng);
+    const auto many = make_queries(n, index_queries, rng);
+    //
+    auto search = [](auto& l, const int q) -> long long { return l.search(q); };
+    auto locate = [](auto& l, const int q) -> long long { return l.locate(q); };
+    std::printf("%zu,search,%.1f,%.1f\n", n, per_query_ns(plain, few, search), per_query_ns(indexed, many, search));
+    std::printf("%zu,locate,%.1f,%.1f\n", n, per_query_ns(plain, few, locate), per_query_ns(indexed, many, locate));
+    //
+    // after a middle insert the first locate() renumbers everything once
+    indexed.push_at(n / 2, -1);
+    const double renumber = bench::best_ms(1, [&] { bench::do_not_optimize(indexed.locate(keys[n - 1])); });
+    std::printf("%zu,locate_after_push_at,-,%.1f\n", n, renumber * 1e6);
+    //
+    // update cost: a push_back/pop_front cycle over the whole list
+    const double plain_cycle = bench::best_ms(3, [&] {
+      for (std::size_t i = 0; i < n; ++i) { plain.push_back(plain.front()); plain.pop_front(); }
+    });
+    const double indexed_cycle = bench::best_ms(3, [&] {
+      for (std::size_t i = 0; i < n; ++i) { indexed.push_back(indexed.front()); indexed.pop_front(); }
+    });
+    std::printf("%zu,push_back+pop_front,%.1f,%.1f\n", n,
+                plain_cycle * 1e6 / static_cast<double>(n), indexed_cycle * 1e6 / static_cast<double>(n));
+    //
+    std::printf("%zu,index_bytes_per_element,-,%.1f\n", n,
+                static_cast<double>(indexed.index_bytes()) / static_cast<double>(indexed.size()));
+  }
+}
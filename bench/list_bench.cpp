@@ -0,0 +1,310 @@
+/**
+* @file list_bench.cpp
+* @brief microbenchmark of every List_ operation against std::forward_list,
+*        std::list and std::vector, results as CSV (default) or JSON
+* usage: list_bench [--json] [--min-size N] [--max-size N] [--budget-ms MS]
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+  /*
+  * one adapter per container, every operation is expressed the way that container
+  * does it best, so the numbers compare data structures rather than wrappers
+  */
+  template <typename C> struct adapter;
+
+  template <>
+  struct adapter<List_<int>> {
+    using type = List_<int>;
+    static constexpr const char* name = "List_";
+    static auto fill(type& c, const std::vector<int>& v) -> void  { for (const auto i : v) { c.push_back(i); } }
+    static auto push_back(type& c, int v) -> void                 { c.push_back(v); }
+    static auto push_front(type& c, int v) -> void                { c.push_front(v); }
+    static auto push_at(type& c, std::size_t p, int v) -> void    { c.push_at(p, v); }
+    static auto push_after(type& c, int after, int v) -> void     { c.push_after(int{after}, int{v}); }
+    static auto push_before(type& c, int before, int v) -> void   { c.push_before(before, v); }
+    static auto pop_back(type& c) -> void                         { c.pop_back(); }
+    static auto pop_front(type& c) -> void                        { c.pop_front(); }
+    static auto pop_at(type& c, std::size_t p) -> void            { c.pop_at(p); }
+    static auto at(type& c, std::size_t p) -> int                 { return c.at(p); }
+    static auto search(const type& c, int v) -> bool              { return c.search(v); }
+    static auto locate(const type& c, int v) -> std::int64_t      { return c.locate(v); }
+    static auto sort(type& c) -> void                             { c.sort(); }
+    static auto split(type& c) -> std::size_t                     { type l1, l2; std::move(c).split(l1, l2); return l1.size() + l2.size(); }
+    static auto merge(type& c, type& a, type& b) -> void          { c.merge(std::move(a), std::move(b)); }
+    static auto clear(type& c) -> void                            { c.clear(); }
+  };
+
+  template <>
+  struct adapter<std::forward_list<int>> {
+    using type = std::forward_list<int>;
+    static constexpr const char* name = "std::forward_list";
+    static auto before_end(type& c) -> type::iterator             { auto it = c.before_begin(); for (auto next = std::next(it); next != c.end(); ++it, ++next) {} return it; }
+    static auto fill(type& c, const std::vector<int>& v) -> void  { auto it = c.before_begin(); for (const auto i : v) { it = c.insert_after(it, i); } }
+    static auto push_back(type& c, int v) -> void                 { c.insert_after(before_end(c), v); }
+    static auto push_front(type& c, int v) -> void                { c.push_front(v); }
+    static auto push_at(type& c, std::size_t p, int v) -> void    { c.insert_after(std::next(c.before_begin(), static_cast<std::ptrdiff_t>(p)), v); }
+    static auto push_after(type& c, int after, int v) -> void     { if (auto it = std::find(c.begin(), c.end(), after); it != c.end()) { c.insert_after(it, v); } }
+    static auto push_before(type& c, int before, int v) -> void   {
+      for (auto prev = c.before_begin(), it = c.begin(); it != c.end(); ++prev, ++it) {
+        if (*it == before) { c.insert_after(prev, v); return; }
+      }
+    }
+    static auto pop_back(type& c) -> void                         {
+      auto prev = c.before_begin();
+      for (auto it = c.begin(); std::next(it) != c.end(); ++it) { ++prev; }
+      c.erase_after(prev);
+    }
+    static auto pop_front(type& c) -> void                        { c.pop_front(); }
+    static auto pop_at(type& c, std::size_t p) -> void            { c.erase_after(std::next(c.before_begin(), static_cast<std::ptrdiff_t>(p))); }
+    static auto at(type& c, std::size_t p) -> int                 { return *std::next(c.begin(), static_cast<std::ptrdiff_t>(p)); }
+    static auto search(const type& c, int v) -> bool              { return std::find(c.begin(), c.end(), v) != c.end(); }
+    static auto locate(const type& c, int v) -> std::int64_t      {
+      std::int64_t i = 0;
+      for (const auto x : c) { if (x == v) { return i; } ++i; }
+      return -1;
+    }
+    static auto sort(type& c) -> void                             { c.sort(); }
+    static auto split(type& c) -> std::size_t                     {
+      const auto n = static_cast<std::size_t>(std::distance(c.begin(), c.end()));
+      type l2;
+      l2.splice_after(l2.before_begin(), c, std::next(c.before_begin(), static_cast<std::ptrdiff_t>(n / 2)), c.end());
+      return n;
+    }
+    static auto merge(type& c, type& a, type& b) -> void          { c.splice_after(before_end(c), a); c.splice_after(before_end(c), b); }
+    static auto clear(type& c) -> void                            { c.clear(); }
+  };
+
+  template <>
+  struct adapter<std::list<int>> {
+    using type = std::list<int>;
+    static constexpr const char* name = "std::list";
+    static auto fill(type& c, const std::vector<int>& v) -> void  { for (const auto i : v) { c.push_back(i); } }
+    static auto push_back(type& c, int v) -> void                 { c.push_back(v); }
+    static auto push_front(type& c, int v) -> void                { c.push_front(v); }
+    static auto push_at(type& c, std::size_t p, int v) -> void    { c.insert(std::next(c.begin(), static_cast<std::ptrdiff_t>(p)), v); }
+    static auto push_after(type& c, int after, int v) -> void     { if (auto it = std::find(c.begin(), c.end(), after); it != c.end()) { c.insert(std::next(it), v); } }
+    static auto push_before(type& c, int before, int v) -> void   { if (auto it = std::find(c.begin(), c.end(), before); it != c.end()) { c.insert(it, v); } }
+    static auto pop_back(type& c) -> void                         { c.pop_back(); }
+    static auto pop_front(type& c) -> void                        { c.pop_front(); }
+    static auto pop_at(type& c, std::size_t p) -> void            { c.erase(std::next(c.begin(), static_cast<std::ptrdiff_t>(p))); }
+    static auto at(type& c, std::size_t p) -> int                 { return *std::next(c.begin(), static_cast<std::ptrdiff_t>(p)); }
+    static auto search(const type& c, int v) -> bool              { return std::find(c.begin(), c.end(), v) != c.end(); }
+    static auto locate(const type& c, int v) -> std::int64_t      {
+      const auto it = std::find(c.begin(), c.end(), v);
+      return it == c.end() ? -1 : std::distance(c.begin(), it);
+    }
+    static auto sort(type& c) -> void                             { c.sort(); }
+    static auto split(type& c) -> std::size_t                     {
+      type l2;
+      l2.splice(l2.end(), c, std::next(c.begin(), static_cast<std::ptrdiff_t>(c.size() / 2)), c.end());
+      return c.size() + l2.size();
+    }
+    static auto merge(type& c, type& a, type& b) -> void          { c.splice(c.end(), a); c.splice(c.end(), b); }
+    static auto clear(type& c) -> void                            { c.clear(); }
+  };
+
+  template <>
+  struct adapter<std::vector<int>> {
+    using type = std::vector<int>;
+    static constexpr const char* name = "std::vector";
+    static auto fill(type& c, const std::vector<int>& v) -> void  { for (const auto i : v) { c.push_back(i); } }
+    static auto push_back(type& c, int v) -> void                 { c.push_back(v); }
+    static auto push_front(type& c, int v) -> void                { c.insert(c.begin(), v); }
+    static auto push_at(type& c, std::size_t p, int v) -> void    { c.insert(c.begin() + static_cast<std::ptrdiff_t>(p), v); }
+    static auto push_after(type& c, int after, int v) -> void     { if (auto it = std::find(c.begin(), c.end(), after); it != c.end()) { c.insert(std::next(it), v); } }
+    static auto push_before(type& c, int before, int v) -> void   { if (auto it = std::find(c.begin(), c.end(), before); it != c.end()) { c.insert(it, v); } }
+    static auto pop_back(type& c) -> void                         { c.pop_back(); }
+    static auto pop_front(type& c) -> void                        { c.erase(c.begin()); }
+    static auto pop_at(type& c, std::size_t p) -> void            { c.erase(c.begin() + static_cast<std::ptrdiff_t>(p)); }
+    static auto at(type& c, std::size_t p) -> int                 { return c[p]; }
+    static auto search(const type& c, int v) -> bool              { return std::find(c.begin(), c.end(), v) != c.end(); }
+    static auto locate(const type& c, int v) -> std::int64_t      {
+      const auto it = std::find(c.begin(), c.end(), v);
+      return it == c.end() ? -1 : std::distance(c.begin(), it);
+    }
+    static auto sort(type& c) -> void                             { std::sort(c.begin(), c.end()); }
+    static auto split(type& c) -> std::size_t                     {
+      const auto mid = c.begin() + static_cast<std::ptrdiff_t>(c.size() / 2);
+      type l1(c.begin(), mid), l2(mid, c.end());
+      return l1.size() + l2.size();
+    }
+    static auto merge(type& c, type& a, type& b) -> void          { c.insert(c.end(), a.begin(), a.end()); c.insert(c.end(), b.begin(), b.end()); }
+    static auto clear(type& c) -> void                            { c.clear(); }
+  };
+
+  struct result {
+    std::string container;
+    std::string operation;
+    std::size_t size  = {};
+    std::size_t ops   = {};
+    double      ns    = {};
+  };
+
+  struct options {
+    bool        json       = false;
+    std::size_t min_size   = 10;
+    std::size_t max_size   = 10'000'000;
+    double      budget_ms  = 200;
+  };
+
+  using clock_type = std::chrono::steady_clock;
+
+  auto elapsed_ns(const clock_type::time_point start) -> double
+  {
+    return std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+  }
+
+  /*
+  * runs `op(i)` on one container in batches of 1, 2, 4, .. calls until `max_ops`
+  * calls were made or the time budget is spent, so O(1) and O(n) operations both
+  * get a meaningful sample without a per-container cost model
+  */
+  template <typename Op>
+  auto run_batches(const options& opt, const std::size_t max_ops, Op&& op) -> std::pair<std::size_t, double>
+  {
+    std::size_t done  = 0;
+    double      total = 0;
+    for (std::size_t batch = 1; done < max_ops && total < opt.budget_ms * 1e6; batch *= 2) {
+      const std::size_t count = std::min(batch, max_ops - done);
+      const auto start = clock_type::now();
+      for (std::size_t i = 0; i < count; ++i) { op(done + i); }
+      total += elapsed_ns(start);
+      done  += count;
+    }
+    return {done, total};
+  }
+
+  /* repeats a whole-container operation on freshly built containers within the budget */
+  template <typename Setup, typename Op>
+  auto run_whole(const options& opt, Setup&& setup, Op&& op) -> std::pair<std::size_t, double>
+  {
+    std::size_t done  = 0;
+    double      total = 0;
+    while (done < 1000 && total < opt.budget_ms * 1e6) {
+      auto state = setup();
+      const auto start = clock_type::now();
+      op(state);
+      total += elapsed_ns(start);
+      ++done;
+    }
+    return {done, total};
+  }
+
+  template <typename C>
+  auto bench_container(const options& opt, const std::size_t n, std::vector<result>& out) -> void
+  {
+    using A = adapter<C>;
+    const int  mid  = static_cast<int>(n / 2);
+    const auto emit = [&](const char* op, const std::pair<std::size_t, double> r) {
+      out.push_back({A::name, op, n, r.first, r.second});
+    };
+    std::vector<int> ascending(n);
+    std::iota(ascending.begin(), ascending.end(), 0);
+    const auto filled = [&] { C c; A::fill(c, ascending); return c; };
+    int sink = 0;
+
+    // read-only operations can sample more calls than there are elements
+    const std::size_t reads = std::max<std::size_t>(n, 1 << 16);
+
+    { C c = filled(); emit("push_back",   run_batches(opt, n, [&](std::size_t i) { A::push_back(c, static_cast<int>(i)); })); }
+    { C c = filled(); emit("push_front",  run_batches(opt, n, [&](std::size_t i) { A::push_front(c, static_cast<int>(i)); })); }
+    { C c = filled(); emit("push_at",     run_batches(opt, n, [&](std::size_t i) { A::push_at(c, n / 2, static_cast<int>(i)); })); }
+    { C c = filled(); emit("push_after",  run_batches(opt, n, [&](std::size_t i) { A::push_after(c, mid, static_cast<int>(i)); })); }
+    { C c = filled(); emit("push_before", run_batches(opt, n, [&](std::size_t i) { A::push_before(c, mid, static_cast<int>(i)); })); }
+    { C c = filled(); emit("pop_back",    run_batches(opt, n - 1, [&](std::size_t) { A::pop_back(c); })); }
+    { C c = filled(); emit("pop_front",   run_batches(opt, n - 1, [&](std::size_t) { A::pop_front(c); })); }
+    { C c = filled(); emit("pop_at",      run_batches(opt, n / 2, [&](std::size_t i) { A::pop_at(c, (n - i) / 2); })); }
+    { C c = filled(); emit("at",          run_batches(opt, reads, [&](std::size_t i) { sink += A::at(c, (i * 7919) % n); })); }
+    { C c = filled(); emit("search",      run_batches(opt, reads, [&](std::size_t) { sink += A::search(c, -1); })); }
+    { C c = filled(); emit("locate",      run_batches(opt, reads, [&](std::size_t) { sink += static_cast<int>(A::locate(c, static_cast<int>(n - 1))); })); }
+    {
+      std::vector<int> input(n);
+      std::mt19937 rng(42);
+      for (auto& i : input) { i = static_cast<int>(rng()); }
+      emit("sort", run_whole(opt, [&] { C c; A::fill(c, input); return c; },
+                                [](C& c) { A::sort(c); }));
+    }
+    emit("split", run_whole(opt, filled, [&](C& c) { sink += static_cast<int>(A::split(c)); }));
+    const std::vector<int> lower(ascending.begin(), ascending.begin() + static_cast<std::ptrdiff_t>(n / 2));
+    const std::vector<int> upper(ascending.begin() + static_cast<std::ptrdiff_t>(n / 2), ascending.end());
+    emit("merge", run_whole(opt, [&] {
+                                   std::pair<C, C> halves;
+                                   A::fill(halves.first, lower);
+                                   A::fill(halves.second, upper);
+                                   return halves;
+                                 },
+                                 [](std::pair<C, C>& h) { C c; A::merge(c, h.first, h.second); }));
+    emit("clear", run_whole(opt, filled, [](C& c) { A::clear(c); }));
+    { C c = filled(); emit("iterate", run_whole(opt, [] { return 0; }, [&](int&) { sink += static_cast<int>(std::accumulate(c.begin(), c.end(), 0LL)); })); }
+    bench::do_not_optimize(sink);
+  }
+
+  auto print(const options& opt, const std::vector<result>& results) -> void
+  {
+    if (!opt.json) {
+      std::printf("container,operation,size,ops,total_ns,ns_per_op\n");
+      for (const auto& r : results) {
+        std::printf("%s,%s,%zu,%zu,%.0f,%.2f\n", r.container.c_str(), r.operation.c_str(),
+                    r.size, r.ops, r.ns, r.ns / static_cast<double>(r.ops));
+      }
+      return;
+    }
+    std::printf("[\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      const auto& r = results[i];
+      std::printf("  {\"container\": \"%s\", \"operation\": \"%s\", \"size\": %zu, \"ops\": %zu, \"total_ns\": %.0f, \"ns_per_op\": %.2f}%s\n",
+                  r.container.c_str(), r.operation.c_str(), r.size, r.ops, r.ns,
+                  r.ns / static_cast<double>(r.ops), i + 1 < results.size() ? "," : "");
+    }
+    std::printf("]\n");
+  }
+
+  auto parse(int argc, char** argv) -> options
+  {
+    options opt;
+    for (int i = 1; i < argc; ++i) {
+      const bool has_value = i + 1 < argc;
+      if      (std::strcmp(argv[i], "--json") == 0)                   { opt.json = true; }
+      else if (std::strcmp(argv[i], "--min-size") == 0 && has_value)  { opt.min_size  = std::strtoull(argv[++i], nullptr, 10); }
+      else if (std::strcmp(argv[i], "--max-size") == 0 && has_value)  { opt.max_size  = std::strtoull(argv[++i], nullptr, 10); }
+      else if (std::strcmp(argv[i], "--budget-ms") == 0 && has_value) { opt.budget_ms = std::strtod(argv[++i], nullptr); }
+      else {
+        std::fprintf(stderr, "usage: %s [--json] [--min-size N] [--max-size N] [--budget-ms MS]\n", argv[0]);
+        std::exit(2);
+      }
+    }
+    opt.min_size = std::max<std::size_t>(opt.min_size, 2);
+    return opt;
+  }
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+  const options opt = parse(argc, argv);
+  std::vector<result> results;
+  for (std::size_t n = opt.min_size; n <= opt.max_size; n *= 10) {
+    bench_container<List_<int>>(opt, n, results);
+    bench_container<std::forward_list<int>>(opt, n, results);
+    bench_container<std::list<int>>(opt, n, results);
+    bench_container<std::vector<int>>(opt, n, results);
+  }
+  print(opt, results);
+}
@@ -0,0 +1,73 @@
+/**
+* @file locked_list_bench.cpp
+* @brief positional writers in separate regions of one long list: List_ behind one
+*        mutex vs the hand-over-hand LockedList_
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "locked_list.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t length = 10'000; // list length, kept steady by paired push/pop
+  constexpr std::size_t ops    = 2'000;  // push_at + pop_at pairs per configuration
+
+  /* the way positional mutations are shared today: one mutex around a List_ */
+  class mutex_list {
+  private:
+    std::mutex m_lock;
+    List_<int> m_list;
+    //
+  public:
+    auto push_back(const int value) -> void { std::lock_guard lock(m_lock); m_list.push_back(value); }
+    auto push_at(const std::size_t pos, const int value) -> void { std::lock_guard lock(m_lock); m_list.push_at(pos, value); }
+    auto pop_at(const std::size_t pos) -> void { std::lock_guard lock(m_lock); m_list.pop_at(pos); }
+  };
+
+  /* wall time for `threads` writers, writer t inserting and erasing inside region t */
+  template <typename List>
+  auto run(const std::size_t threads) -> double
+  {
+    List list;
+    for (std::size_t i = 0; i < length; ++i) { list.push_back(static_cast<int>(i)); }
+    std::atomic<bool> go = {false};
+    const std::size_t region = length / threads;
+    //
+    return bench::best_ms(1, [&] {
+      std::vector<std::jthread> workers;
+      for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          std::mt19937 rng(static_cast<unsigned>(t) + 1);
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          for (std::size_t i = t; i < ops; i += threads) {
+            const std::size_t pos = t * region + rng() % region;
+            list.push_at(pos, static_cast<int>(i));
+            list.pop_at(pos);
+          }
+        });
+      }
+      go.store(true, std::memory_order_release);
+    });
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu push_at/pop_at pairs on a %zu element list, %u hardware threads\n",
+              ops, length, std::thread::hardware_concurrency());
+  std::printf("threads,mutex_list_ms,locked_list_ms\n");
+  for (const std::size_t threads : {1, 2, 4, 8, 16}) {
+    const double global = run<mutex_list>(threads);
+    const double coupled = run<LockedList_<int>>(threads);
+    std::printf("%zu,%.2f,%.2f\n", threads, global, coupled);
+  }
+}
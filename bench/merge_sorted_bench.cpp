@@ -0,0 +1,81 @@
+/**
+* @file merge_sorted_bench.cpp
+* @brief combining sorted lists: copy-merge + sort vs merge_sorted, and many shards
+*        merged pairwise vs the k-way heap merge
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+  using list_type = List_<int>;
+
+  auto sorted_list(const std::size_t n, std::mt19937& rng) -> list_type
+  {
+    std::vector<int> v(n);
+    for (auto& i : v) { i = static_cast<int>(rng() % 1'000'000'000); }
+    std::sort(v.begin(), v.end());
+    list_type l;
+    for (const auto i : v) { l.push_back(i); }
+    return l;
+  }
+
+  auto shards(const std::size_t k, const std::size_t n, std::mt19937& rng) -> std::vector<list_type>
+  {
+    std::vector<list_type> out;
+    for (std::size_t i = 0; i < k; ++i) { out.push_back(sorted_list(n, rng)); }
+    return out;
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::mt19937 rng(42);
+  constexpr std::size_t n = 1'000'000;
+  std::printf("two sorted lists of %zu ints\n", n);
+  {
+    list_type a = sorted_list(n, rng), b = sorted_list(n, rng), out;
+    const double ms = bench::best_ms(1, [&] { out.merge(a, b); out.sort(); });
+    std::printf("  merge(l1, l2) + sort()           %10.2f ms\n", ms);
+  }
+  {
+    list_type a = sorted_list(n, rng), b = sorted_list(n, rng);
+    const double ms = bench::best_ms(1, [&] { a.merge_sorted(std::move(b)); });
+    std::printf("  merge_sorted(std::move(other))   %10.2f ms\n", ms);
+  }
+
+  for (const std::size_t k : {4u, 64u, 1024u}) {
+    const std::size_t per = 4'000'000 / k;
+    std::printf("%zu sorted shards of %zu ints\n", k, per);
+    if (k <= 64) { // O(n * k), minutes at 1024 shards
+      auto in = shards(k, per, rng);
+      const double ms = bench::best_ms(1, [&] {
+        for (std::size_t i = 1; i < in.size(); ++i) { in[0].merge_sorted(std::move(in[i])); }
+      });
+      std::printf("  repeated merge_sorted into one   %10.2f ms\n", ms);
+    }
+    {
+      auto in = shards(k, per, rng);
+      const double ms = bench::best_ms(1, [&] {
+        for (std::size_t width = 1; width < in.size(); width *= 2) {
+          for (std::size_t i = 0; i + width < in.size(); i += 2 * width) { in[i].merge_sorted(std::move(in[i + width])); }
+        }
+      });
+      std::printf("  pairwise merge_sorted tree       %10.2f ms\n", ms);
+    }
+    {
+      auto in = shards(k, per, rng);
+      list_type out;
+      const double ms = bench::best_ms(1, [&] { out = list_type::merge_sorted(std::span(in)); });
+      std::printf("  k-way merge_sorted(span)         %10.2f ms\n", ms);
+    }
+  }
+}
@@ -0,0 +1,40 @@
+/**
+* @file parallel_sort_bench.cpp
+* @brief List_::parallel_sort speedup at 1/2/4/8 threads
+* usage: parallel_sort_bench [n = 10000000]
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <random>
+#include <thread>
+#include <vector>
+
+auto main(int argc, char** argv) -> int
+{
+  const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+  std::vector<int> input(n);
+  std::mt19937 rng(42);
+  for (auto& i : input) { i = static_cast<int>(rng()); }
+
+  std::printf("parallel_sort of %zu random ints, %u hardware threads\n", n, std::thread::hardware_concurrency());
+  double single = {};
+  for (const std::size_t threads : {1u, 2u, 4u, 8u}) {
+    double ms = {};
+    for (std::size_t rep = 0; rep < 3; ++rep) { // filling is kept out of the timed region
+      // a fresh arena per run: nodes recycled by malloc after a sort would be scattered
+      std::pmr::monotonic_buffer_resource arena;
+      pmr::List_<int> l(&arena);
+      for (const auto i : input) { l.push_back(i); }
+      const double t = bench::best_ms(1, [&] { l.parallel_sort(threads); });
+      bench::do_not_optimize(l.front());
+      if (rep == 0 || t < ms) { ms = t; }
+    }
+    if (threads == 1) { single = ms; }
+    std::printf("  threads=%zu  %9.2f ms  speedup x%.2f\n", threads, ms, single / ms);
+  }
+}
@@ -0,0 +1,79 @@
+/**
+* @file persistent_bench.cpp
+* @brief snapshotting a 1M element list: deep copy of List_ vs PersistentList_,
+*        and handing versions to reader threads while the writer keeps changing its own
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "persistent_list.hpp"
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t n       = 1'000'000;
+  constexpr std::size_t readers = 4;
+
+  template <typename List>
+  auto sum(const List& l) -> long long
+  {
+    long long total = {};
+    for (const auto i : l) { total += i; }
+    return total;
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  List_<int> list;
+  for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<int>(i)); }
+  PersistentList_<int> persistent(list);
+
+  std::printf("snapshot of %zu ints (best of 5)\n", n);
+  const double deep = bench::best_ms(5, [&] {
+    List_<int> copy(list);
+    bench::do_not_optimize(copy);
+  });
+  std::printf("  List_ copy                         %10.3f ms\n", deep);
+  const double snap = bench::best_ms(5, [&] {
+    PersistentList_<int> copy = persistent.snapshot();
+    bench::do_not_optimize(copy);
+  });
+  std::printf("  PersistentList_ snapshot           %10.6f ms\n", snap);
+  const double edit = bench::best_ms(5, [&] {
+    PersistentList_<int> copy = persistent.snapshot();
+    copy.pop_front();
+    copy.push_front(-1);
+    bench::do_not_optimize(copy);
+  });
+  std::printf("  snapshot + pop_front + push_front  %10.6f ms\n", edit);
+  const double mid = bench::best_ms(5, [&] {
+    PersistentList_<int> copy = persistent.snapshot();
+    copy.push_at(n / 2, -1);
+    bench::do_not_optimize(copy);
+  });
+  std::printf("  snapshot + push_at(n / 2)          %10.3f ms\n", mid);
+
+  std::printf("%zu readers summing their own version while the writer pops/pushes\n", readers);
+  for (const bool deep_copy : {true, false}) {
+    PersistentList_<int> writer = persistent;
+    std::vector<long long> sums(readers);
+    const double ms = bench::best_ms(1, [&] {
+      std::vector<std::jthread> threads;
+      for (std::size_t r = 0; r < readers; ++r) {
+        if (deep_copy) {
+          threads.emplace_back([copy = List_<int>(list), &sums, r] { sums[r] = sum(copy); });
+        } else {
+          threads.emplace_back([copy = writer.snapshot(), &sums, r] { sums[r] = sum(copy); });
+        }
+        for (int i = 0; i < 1000; ++i) { writer.pop_front(); writer.push_front(i); }
+      }
+    });
+    std::printf("  %-32s %10.3f ms  (sum %lld)\n",
+                deep_copy ? "List_ copy per reader" : "PersistentList_ snapshot per reader", ms, sums[0]);
+  }
+}
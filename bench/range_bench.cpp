@@ -0,0 +1,86 @@
+/**
+* @file range_bench.cpp
+* @brief loading 10M ints from a std::vector into a List_: one push_back per element
+*        ( what the constructors used to do ) vs append_range, which takes every node
+*        from one slab, and the cost of traversing and freeing the result
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t count = 10'000'000;
+  constexpr std::size_t reps  = 3;
+
+  using counted_list = List_<int, bench::counting_allocator<int>>;
+
+  struct timings {
+    double load_ms;
+    double sum_ms;
+    double free_ms;
+    std::size_t allocations;
+  };
+
+  auto ms_since(const std::chrono::steady_clock::time_point start) -> double
+  {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  /* best of `reps` for each phase, `load` fills an empty list from `source` */
+  template <typename Load>
+  auto run(const std::vector<int>& source, Load load) -> timings
+  {
+    timings best = {};
+    for (std::size_t r = 0; r < reps; ++r) {
+      std::optional<counted_list> list(std::in_place);
+      bench::alloc_stats::reset();
+      auto start = std::chrono::steady_clock::now();
+      load(*list, source);
+      const double load_ms = ms_since(start);
+      const std::size_t allocations = bench::alloc_stats::calls;
+      //
+      start = std::chrono::steady_clock::now();
+      long long sum = {};
+      for (const int i : *list) { sum += i; }
+      bench::do_not_optimize(sum);
+      const double sum_ms = ms_since(start);
+      //
+      start = std::chrono::steady_clock::now();
+      list.reset();
+      const double free_ms = ms_since(start);
+      //
+      if (r == 0 || load_ms < best.load_ms) { best.load_ms = load_ms; }
+      if (r == 0 || sum_ms  < best.sum_ms)  { best.sum_ms  = sum_ms; }
+      if (r == 0 || free_ms < best.free_ms) { best.free_ms = free_ms; }
+      best.allocations = allocations;
+    }
+    return best;
+  }
+
+  auto report(const char* name, const timings& t) -> void
+  {
+    std::printf("%s,%.1f,%.1f,%.1f,%zu\n", name, t.load_ms, t.sum_ms, t.free_ms, t.allocations);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::vector<int> source(count);
+  std::iota(source.begin(), source.end(), 0);
+  //
+  std::printf("%zu ints from a std::vector, best of %zu\n", count, reps);
+  std::printf("load,load_ms,traverse_ms,free_ms,allocations\n");
+  report("push_back loop", run(source, [](counted_list& l, const std::vector<int>& v) {
+    for (const int i : v) { l.push_back(i); }
+  }));
+  report("append_range",   run(source, [](counted_list& l, const std::vector<int>& v) { l.append_range(v); }));
+  report("assign",         run(source, [](counted_list& l, const std::vector<int>& v) { l.assign(v.begin(), v.end()); }));
+}
@@ -0,0 +1,117 @@
+/**
+* @file rcu_bench.cpp
+* @brief reader traversal latency while a writer keeps calling push_back/pop_front:
+*        List_ behind a mutex, behind a shared_mutex, and the epoch reclaimed RcuList_
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "rcu_list.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t length      = 1'000;  // elements, kept steady by the writer
+  constexpr std::size_t readers     = 3;
+  constexpr std::size_t traversals  = 5'000;  // per reader
+
+  /* List_ with readers and the writer excluded by `Mutex` */
+  template <typename Mutex>
+  class guarded_list {
+  private:
+    mutable Mutex m_lock;
+    List_<long>   m_list;
+    //
+  public:
+    auto push_back(const long value) -> void { std::lock_guard lock(m_lock); m_list.push_back(value); }
+    auto pop_front() -> void { std::lock_guard lock(m_lock); m_list.pop_front(); }
+    template <typename Fn>
+    auto for_each(Fn fn) const -> void
+    {
+      if constexpr (std::is_same_v<Mutex, std::shared_mutex>) {
+        std::shared_lock lock(m_lock);
+        for (const auto i : m_list) { fn(i); }
+      } else {
+        std::lock_guard lock(m_lock);
+        for (const auto i : m_list) { fn(i); }
+      }
+    }
+  };
+
+  struct latency {
+    double p50;
+    double p99;
+    double max;
+    std::size_t writes;
+  };
+
+  /* per-traversal wall time of every reader, with or without the writer running */
+  template <typename List>
+  auto run(const bool writer_on) -> latency
+  {
+    List list;
+    for (std::size_t i = 0; i < length; ++i) { list.push_back(static_cast<long>(i)); }
+    std::atomic<std::size_t> done   = {};
+    std::atomic<std::size_t> writes = {};
+    std::vector<std::vector<double>> samples(readers);
+    {
+      std::vector<std::jthread> threads;
+      if (writer_on) {
+        threads.emplace_back([&] {
+          long next = static_cast<long>(length);
+          while (done.load(std::memory_order_relaxed) < readers) {
+            list.push_back(next++);
+            list.pop_front();
+            writes.fetch_add(1, std::memory_order_relaxed);
+          }
+        });
+      }
+      for (std::size_t r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r] {
+          samples[r].reserve(traversals);
+          for (std::size_t i = 0; i < traversals; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            long sum = {};
+            list.for_each([&](const long v) { sum += v; });
+            bench::do_not_optimize(sum);
+            const auto stop = std::chrono::steady_clock::now();
+            samples[r].push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+          }
+          done.fetch_add(1, std::memory_order_relaxed);
+        });
+      }
+    }
+    std::vector<double> all;
+    for (const auto& s : samples) { all.insert(all.end(), s.begin(), s.end()); }
+    std::sort(all.begin(), all.end());
+    return {all[all.size() / 2], all[all.size() * 99 / 100], all.back(), writes.load()};
+  }
+
+  template <typename List>
+  auto report(const char* name) -> void
+  {
+    for (const bool writer_on : {false, true}) {
+      const latency l = run<List>(writer_on);
+      std::printf("%s,%s,%.2f,%.2f,%.2f,%zu\n", name, writer_on ? "yes" : "no", l.p50, l.p99, l.max, l.writes);
+    }
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu readers x %zu traversals of %zu elements, %u hardware threads\n",
+              readers, traversals, length, std::thread::hardware_concurrency());
+  std::printf("list,writer,p50_us,p99_us,max_us,writer_push_pop_pairs\n");
+  report<guarded_list<std::mutex>>("List_+mutex");
+  report<guarded_list<std::shared_mutex>>("List_+shared_mutex");
+  report<RcuList_<long>>("RcuList_");
+}
@@ -0,0 +1,82 @@
+/**
+* @file sharded_bench.cpp
+* @brief many threads appending into one logical list: List_ behind one mutex vs
+*        ShardedList_ per-thread shards plus the relinking combine()
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "sharded_list.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t items = 4'000'000; // per configuration, split over the threads
+
+  struct result {
+    double ingest_ms;
+    double combine_us;
+  };
+
+  /* `threads` threads appending `items` values between them, then the result as one List_ */
+  auto run_locked(const std::size_t threads) -> result
+  {
+    std::mutex lock;
+    List_<long> list;
+    std::atomic<bool> go = {false};
+    const double ms = bench::best_ms(1, [&] {
+      std::vector<std::jthread> workers;
+      for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          for (std::size_t i = t; i < items; i += threads) {
+            std::lock_guard guard(lock);
+            list.push_back(static_cast<long>(i));
+          }
+        });
+      }
+      go.store(true, std::memory_order_release);
+    });
+    if (list.size() != items) { std::fprintf(stderr, "- lost elements\n"); }
+    return {ms, 0.0}; // already one list
+  }
+
+  auto run_sharded(const std::size_t threads) -> result
+  {
+    ShardedList_<long> builder;
+    std::atomic<bool> go = {false};
+    const double ms = bench::best_ms(1, [&] {
+      std::vector<std::jthread> workers;
+      for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          for (std::size_t i = t; i < items; i += threads) { builder.push_back(static_cast<long>(i)); }
+        });
+      }
+      go.store(true, std::memory_order_release);
+    });
+    List_<long> list;
+    const double combine = bench::best_ms(1, [&] { list = builder.combine(); });
+    if (list.size() != items) { std::fprintf(stderr, "- lost elements\n"); }
+    return {ms, combine * 1e3};
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu appends, %u hardware threads\n", items, std::thread::hardware_concurrency());
+  std::printf("threads,mutex_list_mops,sharded_mops,sharded_combine_us\n");
+  for (const std::size_t threads : {1, 2, 4, 8, 16}) {
+    const result locked  = run_locked(threads);
+    const result sharded = run_sharded(threads);
+    std::printf("%zu,%.2f,%.2f,%.2f\n", threads,
+                items / locked.ingest_ms / 1e3, items / sharded.ingest_ms / 1e3, sharded.combine_us);
+  }
+}
@@ -0,0 +1,69 @@
+/**
+* @file skip_bench.cpp
+* @brief a sorted List_ walked from the head vs SkipList_: search and an
+*        ordered insert followed by erase, at 1k .. 10M elements
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "skip_list.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t scan_budget  = 50'000'000; // elements visited by List_ walks per size
+  constexpr std::size_t skip_queries = 1'000'000;
+
+  /* odd keys in [0, 2n), the lists hold the even ones, so half of the searches miss */
+  auto make_queries(const std::size_t n, const std::size_t count, std::mt19937& rng) -> std::vector<int>
+  {
+    std::vector<int> q(count);
+    for (auto& i : q) { i = static_cast<int>(rng() % (2 * n)); }
+    return q;
+  }
+
+  auto per_op_ns(const double ms, const std::size_t ops) -> double
+  {
+    return ms * 1e6 / static_cast<double>(ops);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::mt19937 rng(7);
+  std::printf("n,op,list_ns,skip_ns\n");
+  for (const std::size_t n : {1'000UL, 10'000UL, 100'000UL, 1'000'000UL, 10'000'000UL}) {
+    List_<int> plain;
+    SkipList_<int> skip;
+    for (std::size_t i = 0; i < n; ++i) {
+      plain.push_back(static_cast<int>(2 * i));
+      skip.insert(static_cast<int>(2 * i)); // ascending, every insert appends
+    }
+    const auto few  = make_queries(n, std::clamp<std::size_t>(scan_budget / n, 10, 2'000), rng);
+    const auto many = make_queries(n, skip_queries, rng);
+    //
+    long long found = {};
+    const double list_search = bench::best_ms(1, [&] { for (const int q : few)  { found += plain.search(q); } });
+    const double skip_search = bench::best_ms(3, [&] { for (const int q : many) { found += skip.search(q); } });
+    bench::do_not_optimize(found);
+    std::printf("%zu,search,%.1f,%.1f\n", n, per_op_ns(list_search, few.size()), per_op_ns(skip_search, many.size()));
+    //
+    // ordered insert of an odd key and its erase, so the size stays at n.
+    // List_ walks to the even predecessor, then locates the key again to pop it
+    const double list_churn = bench::best_ms(1, [&] {
+      for (const int q : few) {
+        plain.push_after(int{q & ~1}, int{q | 1});
+        plain.pop_at(static_cast<std::size_t>(plain.locate(q | 1)));
+      }
+    });
+    const double skip_insert = bench::best_ms(1, [&] {
+      for (const int q : many) { skip.insert(q | 1); skip.erase(q | 1); }
+    });
+    std::printf("%zu,ordered_insert+erase,%.1f,%.1f\n", n, per_op_ns(list_churn, few.size()), per_op_ns(skip_insert, many.size()));
+  }
+}
@@ -0,0 +1,75 @@
+/**
+* @file sort_bench.cpp
+* @brief List_::sort (relinking merge sort) vs the former value-swapping bubble sort
+*        and std::forward_list::sort
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <forward_list>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  /* the sort List_ shipped before: adjacent value swaps until nothing moves */
+  auto bubble_sort(List_<int>& l) -> void
+  {
+    for (bool swapped = true; swapped; ) {
+      swapped = false;
+      for (auto curr = l.begin(), next = std::next(curr); next != l.end(); ++curr, ++next) {
+        if (*curr > *next) { std::swap(*curr, *next); swapped = true; }
+      }
+    }
+  }
+
+  struct record {
+    int  key     = {};
+    char payload[56] = {};
+  };
+
+} // namespace
+
+auto main() -> int
+{
+  std::mt19937 rng(42);
+  std::printf("%10s %14s %14s %14s %14s\n", "n", "bubble(ms)", "List_(ms)", "forward(ms)", "records(ms)");
+  for (const std::size_t n : {1'000u, 10'000u, 100'000u, 1'000'000u}) {
+    std::vector<int> input(n);
+    for (auto& i : input) { i = static_cast<int>(rng()); }
+    const std::size_t reps = n <= 100'000 ? 5 : 3;
+
+    double bubble = -1;
+    if (n <= 10'000) {
+      bubble = bench::best_ms(reps, [&] {
+        List_<int> l;
+        for (const auto i : input) { l.push_back(i); }
+        bubble_sort(l);
+        bench::do_not_optimize(l.front());
+      });
+    }
+    const double merge = bench::best_ms(reps, [&] {
+      List_<int> l;
+      for (const auto i : input) { l.push_back(i); }
+      l.sort();
+      bench::do_not_optimize(l.front());
+    });
+    const double forward = bench::best_ms(reps, [&] {
+      std::forward_list<int> l(input.begin(), input.end());
+      l.sort();
+      bench::do_not_optimize(l.front());
+    });
+    const double records = bench::best_ms(reps, [&] {
+      List_<record> l;
+      for (const auto i : input) { l.push_back(record{i, {}}); }
+      l.sort(std::ranges::less{}, &record::key);
+      bench::do_not_optimize(l.front().key);
+    });
+    std::printf("%10zu %14.2f %14.2f %14.2f %14.2f\n", n, bubble, merge, forward, records);
+  }
+  std::printf("(times include filling the list; bubble skipped above 10k, -1)\n");
+}
@@ -0,0 +1,59 @@
+/**
+* @file splice_bench.cpp
+* @brief copying split/merge vs the relinking split/split_at/split_if/append/merge,
+*        with the allocator calls each one makes
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <utility>
+
+namespace {
+
+  using list_type = List_<int, bench::counting_allocator<int>>;
+
+  constexpr std::size_t n = 1'000'000;
+
+  auto filled(const std::size_t count) -> list_type
+  {
+    list_type l;
+    for (std::size_t i = 0; i < count; ++i) { l.push_back(static_cast<int>(i)); }
+    return l;
+  }
+
+  /* source list plus two outputs, all destroyed outside the timed region */
+  struct state {
+    list_type src;
+    list_type l1;
+    list_type l2;
+  };
+
+  auto with_source() -> state { return {filled(n), {}, {}}; }
+  auto with_halves() -> state { return {{}, filled(n / 2), filled(n / 2)}; }
+
+  /* times `op` on a fresh state and reports the allocations it made */
+  template <typename Op>
+  auto run(const char* name, state (*setup)(), Op&& op) -> void
+  {
+    state s = setup();
+    bench::alloc_stats::reset();
+    const double ms = bench::best_ms(1, [&] { op(s); });
+    std::printf("  %-42s %10.3f ms %10zu allocations\n", name, ms, bench::alloc_stats::calls);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu ints\n", n);
+  run("split(l1, l2)                     (copies)", with_source, [](state& s) { s.src.split(s.l1, s.l2); });
+  run("std::move(l).split(l1, l2)",                with_source, [](state& s) { std::move(s.src).split(s.l1, s.l2); });
+  run("split_at(n / 2)",                           with_source, [](state& s) { s.l1 = s.src.split_at(n / 2); });
+  run("split_if(odd)",                             with_source, [](state& s) { s.l1 = s.src.split_if([](int i) { return (i & 1) != 0; }); });
+  run("merge(l1, l2)                     (copies)", with_halves, [](state& s) { s.src.merge(s.l1, s.l2); });
+  run("merge(std::move(l1), std::move(l2))",       with_halves, [](state& s) { s.src.merge(std::move(s.l1), std::move(s.l2)); });
+  run("append(std::move(other))",                  with_halves, [](state& s) { s.l1.append(std::move(s.l2)); });
+  run("splice_after(cbegin(), std::move(other))",  with_halves, [](state& s) { s.l1.splice_after(s.l1.cbegin(), std::move(s.l2)); });
+}
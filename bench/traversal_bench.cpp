@@ -0,0 +1,74 @@
+/**
+* @file traversal_bench.cpp
+* @brief read-only traversal of 10M ints: List_ raw-pointer iterators vs a chain walked
+*        through shared_ptr copies (the former iterator) and std::forward_list
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+
+#include <cstdio>
+#include <forward_list>
+#include <iterator>
+#include <memory>
+#include <numeric>
+
+static_assert(std::forward_iterator<List_<int>::iterator>);
+static_assert(std::forward_iterator<List_<int>::const_iterator>);
+
+namespace {
+
+  /* node + iterator layout List_ used before: every step copies a shared_ptr */
+  struct shared_node {
+    int                          m_data = {};
+    std::shared_ptr<shared_node> m_next = {nullptr};
+  };
+
+} // namespace
+
+auto main() -> int
+{
+  constexpr std::size_t n    = 10'000'000;
+  constexpr std::size_t reps = 5;
+
+  List_<int> list;
+  std::forward_list<int> flist;
+  auto shared_head = std::make_shared<shared_node>();
+  // filled one after another so each chain gets the same sequential heap layout
+  for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<int>(i)); }
+  for (auto it = flist.before_begin(); const auto i : list) { it = flist.insert_after(it, i); }
+  for (shared_node* tail = shared_head.get(); const auto i : list) {
+    tail->m_next = std::make_shared<shared_node>();
+    tail         = tail->m_next.get();
+    tail->m_data = i;
+  }
+
+  const double shared = bench::best_ms(reps, [&] {
+    long long sum = 0;
+    for (std::shared_ptr<shared_node> it = shared_head->m_next; it != nullptr; it = it->m_next) { sum += it->m_data; }
+    bench::do_not_optimize(sum);
+  });
+  const double accumulate = bench::best_ms(reps, [&] {
+    bench::do_not_optimize(std::accumulate(list.cbegin(), list.cend(), 0LL));
+  });
+  const double range_for = bench::best_ms(reps, [&] {
+    long long sum = 0;
+    for (const auto& i : list) { sum += i; }
+    bench::do_not_optimize(sum);
+  });
+  const double search = bench::best_ms(reps, [&] {
+    bench::do_not_optimize(list.search(-1)); // miss: full scan
+  });
+  const double forward = bench::best_ms(reps, [&] {
+    bench::do_not_optimize(std::accumulate(flist.cbegin(), flist.cend(), 0LL));
+  });
+
+  std::printf("traversal of %zu ints (best of %zu)\n", n, reps);
+  std::printf("  shared_ptr walk (old iterator) : %8.2f ms\n", shared);
+  std::printf("  List_ std::accumulate          : %8.2f ms\n", accumulate);
+  std::printf("  List_ range-for                : %8.2f ms\n", range_for);
+  std::printf("  List_ search (miss)            : %8.2f ms\n", search);
+  std::printf("  std::forward_list accumulate   : %8.2f ms\n", forward);
+
+  while (shared_head) { shared_head = std::move(shared_head->m_next); }
+}
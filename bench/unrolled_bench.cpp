@@ -0,0 +1,54 @@
+/**
+* @file unrolled_bench.cpp
+* @brief UnrolledList_ (16 and 64 elements per node) vs List_: build, iterate,
+*        search, locate and positional access
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "unrolled_list.hpp"
+
+#include <cstdio>
+#include <numeric>
+
+namespace {
+
+  constexpr std::size_t n    = 1'000'000;
+  constexpr std::size_t reps = 5;
+
+  template <typename L>
+  auto run(const char* name) -> void
+  {
+    bench::alloc_stats::reset();
+    L l;
+    for (std::size_t i = 0; i < n; ++i) { l.push_back(static_cast<int>(i)); }
+    const double bytes = static_cast<double>(bench::alloc_stats::bytes) / n;
+
+    const double build = bench::best_ms(reps, [] {
+      L tmp;
+      for (std::size_t i = 0; i < n; ++i) { tmp.push_back(static_cast<int>(i)); }
+      bench::do_not_optimize(tmp.size());
+    });
+    const double iterate = bench::best_ms(reps, [&] {
+      bench::do_not_optimize(std::accumulate(l.cbegin(), l.cend(), 0LL));
+    });
+    const double search = bench::best_ms(reps, [&] { bench::do_not_optimize(l.search(-1)); });
+    const double locate = bench::best_ms(reps, [&] { bench::do_not_optimize(l.locate(static_cast<int>(n - 1))); });
+    const double at = bench::best_ms(reps, [&] {
+      long long sum = 0;
+      for (std::size_t i = 0; i < 100; ++i) { sum += l.at(i * (n / 100)); }
+      bench::do_not_optimize(sum);
+    });
+    std::printf("%-28s %8.1f %10.2f %10.2f %10.2f %10.2f %10.2f\n", name, bytes, build, iterate, search, locate, at);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  std::printf("%zu ints, best of %zu, ms (bytes = allocator bytes per element)\n", n, reps);
+  std::printf("%-28s %8s %10s %10s %10s %10s %10s\n", "", "bytes", "push_back", "iterate", "search", "locate", "100x at");
+  run<List_<int, bench::counting_allocator<int>>>("List_");
+  run<UnrolledList_<int, 16, bench::counting_allocator<int>>>("UnrolledList_<int, 16>");
+  run<UnrolledList_<int, 64, bench::counting_allocator<int>>>("UnrolledList_<int, 64>");
+}
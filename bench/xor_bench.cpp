@@ -0,0 +1,81 @@
+/**
+* @file xor_bench.cpp
+* @brief LIFO use at the tail ( push_back then pop_back ), traversal both ways and
+*        bytes per node: List_, XorList_ and std::list
+*/
+
+#include "bench.hpp"
+#include "list.hpp"
+#include "xor_list.hpp"
+
+#include <cstdio>
+#include <list>
+
+namespace {
+
+  constexpr std::size_t max_list_pop = 20'000; // List_::pop_back is O(n), quadratic beyond
+
+  /* fill with n elements, then pop_back until empty, ns per push + pop */
+  template <typename List>
+  auto lifo_ns(const std::size_t n) -> double
+  {
+    const double ms = bench::best_ms(3, [n] {
+      List list;
+      for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<long>(i)); }
+      for (std::size_t i = 0; i < n; ++i) { list.pop_back(); }
+      bench::do_not_optimize(list.size());
+    });
+    return ms * 1e6 / static_cast<double>(n);
+  }
+
+  /* ns per element walking front to back, then back to front where the list can */
+  template <typename List, bool Backward = false>
+  auto walk_ns(const std::size_t n) -> double
+  {
+    List list;
+    for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<long>(i)); }
+    long sum = {};
+    const double ms = bench::best_ms(5, [&] {
+      if constexpr (Backward) { for (auto it = list.rbegin(); it != list.rend(); ++it) { sum += *it; } }
+      else                    { for (const long v : list) { sum += v; } }
+    });
+    bench::do_not_optimize(sum);
+    return ms * 1e6 / static_cast<double>(n);
+  }
+
+  /* bytes requested from the allocator per element */
+  template <typename List>
+  auto bytes_per_node() -> double
+  {
+    constexpr std::size_t n = 1'000;
+    bench::alloc_stats::reset();
+    {
+      List list;
+      for (std::size_t i = 0; i < n; ++i) { list.push_back(static_cast<long>(i)); }
+    }
+    return static_cast<double>(bench::alloc_stats::bytes) / static_cast<double>(n);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  using list_t     = List_<long>;
+  using xor_t      = XorList_<long>;
+  using std_list_t = std::list<long>;
+  //
+  std::printf("bytes per node ( long ): List_ %.0f, XorList_ %.0f, std::list %.0f\n",
+              bytes_per_node<List_<long, bench::counting_allocator<long>>>(),
+              bytes_per_node<XorList_<long, bench::counting_allocator<long>>>(),
+              bytes_per_node<std::list<long, bench::counting_allocator<long>>>());
+  std::printf("n,op,List_,XorList_,std::list\n");
+  for (const std::size_t n : {1'000UL, 10'000UL, 100'000UL, 1'000'000UL}) {
+    if (n <= max_list_pop) {
+      std::printf("%zu,push_back+pop_back,%.1f,%.1f,%.1f\n", n, lifo_ns<list_t>(n), lifo_ns<xor_t>(n), lifo_ns<std_list_t>(n));
+    } else {
+      std::printf("%zu,push_back+pop_back,-,%.1f,%.1f\n", n, lifo_ns<xor_t>(n), lifo_ns<std_list_t>(n));
+    }
+    std::printf("%zu,walk_forward,%.2f,%.2f,%.2f\n", n, walk_ns<list_t>(n), walk_ns<xor_t>(n), walk_ns<std_list_t>(n));
+    std::printf("%zu,walk_backward,-,%.2f,%.2f\n", n, walk_ns<xor_t, true>(n), walk_ns<std_list_t, true>(n));
+  }
+}
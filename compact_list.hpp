@@ -0,0 +1,658 @@
+/**
+* @file compact_list.hpp
+* @brief a singly linked list whose nodes live in slab arrays and link by 32-bit
+*        slot index instead of by address, a CompactList_<int> node is 8 bytes
+*/
+
+#ifndef COMPACT_LIST_HPP
+#define COMPACT_LIST_HPP
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+* slot i is node i % slab_nodes of slab i / slab_nodes. slabs are allocated as slots are
+* first needed and are only given back by clear() or the destructor, so elements never
+* move and references stay valid until they are popped. popped slots are chained by index
+* into a free list the next push reuses. a list owns its slabs, so nodes can not change
+* lists: there is no O(1) append / splice, and moving a list keeps its iterators only
+* pointing into the moved-from object. at most 2^32 - 1 slots, the last index means null.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class CompactList_
+{
+  using index = std::uint32_t;
+  static constexpr index null_index = std::numeric_limits<index>::max();
+
+  class Node {
+  public:
+    T     m_data;
+    index m_next = {null_index};
+    //
+    template <typename ...Args>
+    constexpr explicit Node(std::in_place_t, Args&& ...args) : m_data(std::forward<Args>(args)...) {}
+  }; // end of class Node
+
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- CompactList_<T, Alloc>: Alloc::value_type must be T");
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+  using table_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_ptr>;
+
+  static_assert(std::is_same_v<typename node_traits::pointer, node_ptr>,
+                "- CompactList_<T, Alloc>: the allocator must hand out raw pointers");
+
+  /* nodes per slab, a power of two so a slot splits into slab and offset by shift and mask */
+  static constexpr std::size_t slab_shift = 10;
+  static constexpr std::size_t slab_nodes = std::size_t{1} << slab_shift;
+
+  std::vector<node_ptr, table_allocator> m_slabs;
+  index       m_head = {null_index};
+  index       m_tail = {null_index};
+  index       m_free = {null_index}; // popped slots, chained through their storage
+  std::size_t m_used = {};           // slots handed out at least once
+  std::size_t m_size = {};
+  [[no_unique_address]] Alloc m_alloc = {};
+
+protected:
+  T _failed_ = {};
+
+private:
+
+  [[nodiscard]] auto slot(const index i) const noexcept -> node_ptr
+  {
+    return m_slabs[i >> slab_shift] + (i & (slab_nodes - 1));
+  }
+
+  /* a free slot's storage holds nothing but the index of the next free slot */
+  static auto free_link(const node_ptr node) noexcept -> index&
+  {
+    return *std::launder(reinterpret_cast<index*>(node));
+  }
+
+  /* a raw slot from the free list, or the next one never used, adding a slab when needed */
+  auto acquire_slot() -> index
+  {
+    if (m_free != null_index) {
+      const index i = m_free;
+      m_free = free_link(slot(i));
+      return i;
+    }
+    if (m_used == null_index) { throw std::length_error("- CompactList_: more than 2^32 - 1 elements"); }
+    if ((m_used >> slab_shift) == m_slabs.size()) { add_slab(); }
+    return static_cast<index>(m_used++);
+  }
+
+  auto release_slot(const index i) noexcept -> void
+  {
+    ::new (static_cast<void*>(slot(i))) index(m_free);
+    m_free = i;
+  }
+
+  auto add_slab() -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr slab = node_traits::allocate(alloc, slab_nodes);
+    try { m_slabs.push_back(slab); }
+    catch (...) { node_traits::deallocate(alloc, slab, slab_nodes); throw; }
+  }
+
+  /* the element is constructed from `args` in place, in a slot not linked yet */
+  template <typename ...Args>
+  auto allocate_node(Args&& ...args) -> index
+  {
+    const index i = acquire_slot();
+    node_allocator alloc(m_alloc);
+    try { node_traits::construct(alloc, slot(i), std::in_place, std::forward<Args>(args)...); }
+    catch (...) { release_slot(i); throw; }
+    return i;
+  }
+
+  auto free_node(const index i) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, slot(i));
+    release_slot(i);
+  }
+
+  /* destroys every element and gives back every slab */
+  auto destroy_nodes() noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    for (index i = m_head; i != null_index; ) {
+      const node_ptr node = slot(i);
+      i = node->m_next;
+      node_traits::destroy(alloc, node);
+    }
+    for (const node_ptr slab : m_slabs) { node_traits::deallocate(alloc, slab, slab_nodes); }
+    m_slabs.clear();
+    m_head = m_tail = m_free = null_index;
+    m_used = {};
+    m_size = {};
+  }
+
+  /* takes over `lh`'s slabs, `lh` is left empty */
+  auto steal(CompactList_& lh) noexcept -> void
+  {
+    m_slabs = std::move(lh.m_slabs);
+    lh.m_slabs.clear();
+    m_head  = std::exchange(lh.m_head, null_index);
+    m_tail  = std::exchange(lh.m_tail, null_index);
+    m_free  = std::exchange(lh.m_free, null_index);
+    m_used  = std::exchange(lh.m_used, 0);
+    m_size  = std::exchange(lh.m_size, 0);
+  }
+
+  /* cuts the chain at `chain` after `count` nodes, returns what follows */
+  auto cut(index chain, std::size_t count) const noexcept -> index
+  {
+    for (; chain != null_index && count > 1; --count) { chain = slot(chain)->m_next; }
+    if (chain == null_index) { return null_index; }
+    const node_ptr node = slot(chain);
+    return std::exchange(node->m_next, null_index);
+  }
+
+  /* last slot of a non-empty chain */
+  auto last_of(index chain) const noexcept -> index
+  {
+    while (slot(chain)->m_next != null_index) { chain = slot(chain)->m_next; }
+    return chain;
+  }
+
+  /**
+  * @brief merges two sorted chains, ties are taken from `left` first. when `comp` or
+  *        `proj` throws, `left` holds both chains in no particular order and `right` is null
+  * @complexity O(n + m)
+  * @return {head, tail} of the merged chain
+  */
+  template <typename Compare, typename Proj>
+  auto merge_chains(index& left, index& right, Compare& comp, Proj& proj) const -> std::pair<index, index>
+  {
+    index  l    = left;
+    index  r    = right;
+    index  head = null_index;
+    index  tail = null_index;
+    index* link = &head;
+    try {
+      while (l != null_index && r != null_index) {
+        const node_ptr ln = slot(l);
+        const node_ptr rn = slot(r);
+        if (std::invoke(comp, std::invoke(proj, rn->m_data), std::invoke(proj, ln->m_data))) {
+          tail = r; r = rn->m_next; *link = tail; link = &rn->m_next;
+        } else {
+          tail = l; l = ln->m_next; *link = tail; link = &ln->m_next;
+        }
+      }
+    } catch (...) {
+      // the merged prefix, then what is left of `left`, then what is left of `right`
+      *link = (l != null_index) ? l : r;
+      if (l != null_index && r != null_index) { slot(last_of(l))->m_next = r; }
+      left  = head;
+      right = null_index;
+      throw;
+    }
+    *link = (l != null_index) ? l : r;
+    if (tail == null_index) { tail = head; } // one side was empty
+    return {head, last_of(tail)};
+  }
+
+  /* forward iterator over slots, `Const` selects const_iterator */
+  template <bool Const>
+  class basic_iterator {
+  private:
+    using list_ptr = std::conditional_t<Const, const CompactList_*, CompactList_*>;
+    //
+    list_ptr list_     {nullptr};
+    node_ptr node_ptr_ {nullptr};
+    //
+    friend class CompactList_;
+    template <bool> friend class basic_iterator;
+    //
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    constexpr basic_iterator(list_ptr list, const index i) noexcept
+      : list_(list), node_ptr_(i == null_index ? nullptr : list->slot(i)) {}
+    // iterator -> const_iterator
+    template <bool C = Const> requires C
+    constexpr basic_iterator(const basic_iterator<false>& itr) noexcept : list_(itr.list_), node_ptr_(itr.node_ptr_) {}
+    //
+    constexpr bool operator==(const basic_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const basic_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
+    }
+    // pre increment
+    constexpr basic_iterator& operator++() noexcept {
+      const index next = node_ptr_->m_next;
+      node_ptr_ = (next == null_index) ? nullptr : list_->slot(next);
+      return *this;
+    }
+    // post increment
+    constexpr basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      ++*this;
+      return old;
+    }
+  }; // end of class basic_iterator
+
+public:
+
+  using iterator        = basic_iterator<false>;
+  using const_iterator  = basic_iterator<true>;
+
+  [[nodiscard]] auto begin()        noexcept -> iterator       { return iterator(this, m_head); }
+  [[nodiscard]] auto end()          noexcept -> iterator       { return iterator(this, null_index); }
+  [[nodiscard]] auto begin()  const noexcept -> const_iterator { return const_iterator(this, m_head); }
+  [[nodiscard]] auto end()    const noexcept -> const_iterator { return const_iterator(this, null_index); }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] auto cend()   const noexcept -> const_iterator { return end(); }
+
+  /* constructors */
+  CompactList_() noexcept = default;
+  //
+  explicit CompactList_(const Alloc& alloc) noexcept
+    : m_slabs(table_allocator(alloc)), m_alloc(alloc) {}
+  //
+  CompactList_(CompactList_&& lh) noexcept
+    : m_slabs(table_allocator(lh.m_alloc)), m_alloc(lh.m_alloc) {
+    steal(lh);
+  }
+  //
+  CompactList_(const CompactList_& lh)
+    : CompactList_(std::allocator_traits<Alloc>::select_on_container_copy_construction(lh.m_alloc)) {
+    reserve(lh.size());
+    for (const auto& i : lh) { push_back(i); }
+  }
+  //
+  explicit CompactList_(const std::initializer_list<T>& arg, const Alloc& alloc = Alloc())
+    : CompactList_(alloc) {
+    reserve(arg.size());
+    for (const auto& i : arg) { push_back(i); }
+  }
+
+  //
+  CompactList_& operator=(const CompactList_& lh) {
+    if (this != &lh) {
+      destroy_nodes();
+      reserve(lh.size());
+      for (const auto& i : lh) { push_back(i); }
+    }
+    return *this;
+  }
+
+  //
+  CompactList_& operator=(CompactList_&& lh) noexcept(std::allocator_traits<Alloc>::is_always_equal::value) {
+    if (this != &lh) {
+      destroy_nodes();
+      if (std::allocator_traits<Alloc>::is_always_equal::value || m_alloc == lh.m_alloc) { steal(lh); }
+      else {
+        reserve(lh.size());
+        for (auto& i : lh) { push_back(std::move(i)); }
+        lh.destroy_nodes();
+      }
+    }
+    return *this;
+  }
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator slabs are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_head == null_index; }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+  /**
+  * @brief elements that fit before another slab is allocated
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t
+  {
+    return std::min<std::size_t>(m_slabs.size() * slab_nodes, null_index);
+  }
+
+  /**
+  * @brief allocates slabs up front for `count` elements in total
+  * @complexity O(count / slab size)
+  * @param count
+  */
+  auto reserve(const std::size_t count) -> void
+  {
+    if (count > null_index) { throw std::length_error("- CompactList_: more than 2^32 - 1 elements"); }
+    while (m_slabs.size() * slab_nodes < count) { add_slab(); }
+  }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]] auto front() -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return slot(m_head)->m_data;
+  }
+
+  /**
+  * @brief return last element&
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]] auto back() -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return slot(m_tail)->m_data;
+  }
+
+  auto print() const -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for ( const auto& i : *this ) { std::cout << i << ' '; }
+  }
+
+  /**
+  * @brief returns the element at `pos`
+  * @complexity O(n)
+  * @param pos
+  * @return T&
+  */
+  [[nodiscard]] auto at(const std::size_t pos) -> T &
+  {
+    if (pos >= size()) [[unlikely]] { empty_list(); return _failed_; }
+    index i = m_head;
+    for (std::size_t j = 0; j < pos; ++j) { i = slot(i)->m_next; }
+    return slot(i)->m_data;
+  }
+
+  /**
+  * @brief constructs an element at end of list from `arg`, in place inside the slot
+  * @complexity O(1)
+  * @param arg : forwarded to T's constructor
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  auto emplace_back(Args&& ...arg) -> T &
+  {
+    const index i = allocate_node(std::forward<Args>(arg)...);
+    if (is_empty()) [[unlikely]] { m_head = i; }
+    else                         { slot(m_tail)->m_next = i; }
+    m_tail = i;
+    ++m_size;
+    return slot(i)->m_data;
+  }
+
+  /**
+  * @brief constructs an element at the beginning of list, in place inside the slot
+  * @complexity O(1)
+  * @param arg : forwarded to T's constructor
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  auto emplace_front(Args&& ...arg) -> T &
+  {
+    const index i = allocate_node(std::forward<Args>(arg)...);
+    slot(i)->m_next = m_head;
+    m_head = i;
+    if (m_tail == null_index) { m_tail = i; }
+    ++m_size;
+    return slot(i)->m_data;
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { emplace_back(arg); }
+  auto push_back(T &&arg)      -> void { emplace_back(std::move(arg)); }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_front(const T &arg) -> void { emplace_front(arg); }
+  auto push_front(T &&arg)      -> void { emplace_front(std::move(arg)); }
+
+  /**
+  * @brief add element at given position
+  * @complexity O(n)
+  * @param pos : size() appends
+  * @param arg
+  */
+  auto push_at(const std::size_t pos, const T &arg) -> void { emplace_at(pos, arg); }
+  auto push_at(const std::size_t pos, T &&arg)      -> void { emplace_at(pos, std::move(arg)); }
+
+  /**
+  * @brief constructs an element at given position, in place inside the slot
+  * @complexity O(n)
+  * @param pos
+  * @param arg : forwarded to T's constructor
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  auto emplace_at(const std::size_t pos, Args&& ...arg) -> T &
+  {
+    if (pos > size())  { empty_list(); return _failed_; }
+    if (pos == 0)      { return emplace_front(std::forward<Args>(arg)...); }
+    if (pos == size()) { return emplace_back(std::forward<Args>(arg)...); }
+    index prev = m_head;
+    for (std::size_t j = 1; j < pos; ++j) { prev = slot(prev)->m_next; }
+    const index i   = allocate_node(std::forward<Args>(arg)...);
+    slot(i)->m_next    = slot(prev)->m_next;
+    slot(prev)->m_next = i;
+    ++m_size;
+    return slot(i)->m_data;
+  }
+
+  /**
+  * @brief remove last element
+  * @complexity O(n)
+  */
+  auto pop_back() -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    if (size() == 1)             { pop_front(); return; }
+    index last = m_head;
+    while (slot(last)->m_next != m_tail) { last = slot(last)->m_next; }
+    free_node(m_tail);
+    m_tail = last;
+    slot(m_tail)->m_next = null_index;
+    --m_size;
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(1)
+  */
+  auto pop_front() -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    const index first = m_head;
+    m_head = slot(first)->m_next;
+    if (m_head == null_index) { m_tail = null_index; }
+    free_node(first);
+    --m_size;
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(n)
+  */
+  auto pop_at(const std::size_t pos) -> void
+  {
+    if (pos >= size()) { empty_list(); return; }
+    if (pos == 0)      { pop_front(); return; }
+    if (pos == size() - 1) { pop_back(); return; }
+    index prev = m_head;
+    for (std::size_t j = 1; j < pos; ++j) { prev = slot(prev)->m_next; }
+    const index victim = slot(prev)->m_next;
+    slot(prev)->m_next = slot(victim)->m_next;
+    free_node(victim);
+    --m_size;
+  }
+
+  /**
+  * @brief: sorts element in ASC order by default put `true` for DESC
+  * @complexity O(n log(n))
+  */
+  auto sort(bool desc = false) -> void
+  {
+    if ( !desc ) [[likely]] { sort(std::ranges::less{}); }
+    else                    { sort(std::ranges::greater{}); }
+  }
+
+  /**
+  * @brief stable bottom-up merge sort, relinks slot indices instead of moving values.
+  *        when `comp` or `proj` throws, the list holds every element in no particular order
+  * @complexity O(n log(n)), O(1) extra space
+  * @param comp : strict weak order on projected values
+  * @param proj : applied to each element before comparing
+  */
+  template <typename Compare, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Compare, std::projected<const_iterator, Proj>>
+  auto sort(Compare comp, Proj proj = {}) -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    for (std::size_t width = 1; width < m_size; width *= 2) {
+      index  rest = m_head;
+      index* link = &m_head;
+      while (rest != null_index) {
+        index left  = rest;
+        index right = cut(left, width);
+        rest        = cut(right, width);
+        index first = null_index;
+        index last  = null_index;
+        try { std::tie(first, last) = merge_chains(left, right, comp, proj); }
+        catch (...) { // the runs merged so far, this pair, then the rest of the chain
+          *link = left;
+          slot(last_of(left))->m_next = rest;
+          m_tail = last_of(m_head);
+          throw;
+        }
+        *link  = first;
+        link   = &slot(last)->m_next;
+        m_tail = last;
+      }
+    }
+  }
+
+  /**
+  * @brief check if the list is sorted ASC
+  * @complexity O(n)
+  */
+  [[nodiscard]] auto is_sorted() const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return true; } // like List_, nothing is out of order
+    for (index i = m_head; slot(i)->m_next != null_index; i = slot(i)->m_next) {
+      if (slot(slot(i)->m_next)->m_data < slot(i)->m_data) { return false; }
+    }
+    return true;
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    for (const auto& i : *this) {
+      if ( i == target ) { return true; }
+    }
+    return false;
+  }
+
+  /**
+  * @brief returns the position of the first element equal to target, -1 when absent
+  * @complexity O(n)
+  * @param target
+  * @return std::int64_t
+  */
+  [[nodiscard]] auto locate(const T& target) const -> std::int64_t
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return -1; }
+    for (std::size_t j = 0; const auto& i : *this ) {
+      if ( i == target ) { return static_cast<std::int64_t>(j); }
+      ++j;
+    }
+    return -1;
+  }
+
+  /**
+  * @brief erases the list and gives back its slabs
+  * @complexity O(n)
+  */
+  auto clear() -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    destroy_nodes();
+  }
+
+  ~CompactList_() {
+    destroy_nodes();
+  }
+}; // end of class CompactList_<T, Alloc>
+
+namespace pmr {
+  /* CompactList_ whose slabs come from a std::pmr::memory_resource */
+  template <typename T>
+  using CompactList_ = ::CompactList_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // COMPACT_LIST_HPP
@@ -0,0 +1,224 @@
+/**
+* @file concurrent_queue.hpp
+* @brief an unbounded lock-free multi-producer multi-consumer FIFO queue
+*        ( Michael & Scott ), the concurrent counterpart of List_'s push_back/pop_front
+*/
+
+#ifndef CONCURRENT_QUEUE_HPP
+#define CONCURRENT_QUEUE_HPP
+
+#include "hazard_pointers.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+* producers link new nodes after m_tail, consumers swing m_head forward; m_head always
+* points at a dummy node whose element was already taken, so the two ends never touch
+* the same node while the queue is non empty. unlinked dummies are retired through
+* hazard pointers. the allocator is called concurrently from every thread and must be
+* thread safe ( std::allocator, synchronized_pool_resource, ... ).
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class ConcurrentQueue_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- ConcurrentQueue_<T, Alloc>: Alloc::value_type must be T");
+
+  class Node {
+  public:
+    std::atomic<Node*> m_next = {nullptr};
+    alignas(T) unsigned char m_storage[sizeof(T)]; // live only between push and pop
+    //
+    [[nodiscard]] auto data() noexcept -> T* { return std::launder(reinterpret_cast<T*>(m_storage)); }
+  }; // end of class Node
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+  using value_traits    = std::allocator_traits<Alloc>;
+
+  auto allocate_node() -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    ::new (static_cast<void*>(new_node)) Node; // the element slot stays raw
+    return new_node;
+  }
+
+  /* frees a node whose element slot is empty */
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    node->~Node();
+    node_allocator alloc(m_alloc);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  struct reclaim {
+    ConcurrentQueue_* m_queue;
+    auto operator()(node_ptr node) const noexcept -> void { m_queue->free_node(node); }
+  };
+
+  [[no_unique_address]] Alloc m_alloc = {};
+  // the ends live on their own cache lines so producers and consumers do not false share
+  alignas(64) std::atomic<node_ptr> m_head = {nullptr};
+  alignas(64) std::atomic<node_ptr> m_tail = {nullptr};
+  alignas(64) mutable hazard::domain<Node, 2, reclaim> m_hazards {reclaim{this}}; // is_empty() protects too
+
+  /* links a node holding an element at the tail */
+  auto link(node_ptr new_node) -> void
+  {
+    for (;;) {
+      node_ptr tail = m_hazards.protect(0, m_tail);
+      node_ptr next = tail->m_next.load(std::memory_order_acquire);
+      if (tail != m_tail.load(std::memory_order_acquire)) { continue; }
+      if (next != nullptr) { // another producer linked but has not swung m_tail yet, help it
+        m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+        continue;
+      }
+      if (tail->m_next.compare_exchange_weak(next, new_node, std::memory_order_release, std::memory_order_relaxed)) {
+        m_tail.compare_exchange_strong(tail, new_node, std::memory_order_release, std::memory_order_relaxed);
+        break;
+      }
+    }
+    m_hazards.clear(0);
+  }
+
+  /* false only when the node can not be allocated, exceptions from T propagate */
+  template <typename U>
+  auto push_value(U&& arg) -> bool
+  {
+    node_ptr new_node = {};
+    try { new_node = allocate_node(); }
+    catch (const std::bad_alloc&) { return false; }
+    try { value_traits::construct(m_alloc, new_node->data(), std::forward<U>(arg)); }
+    catch (...) { free_node(new_node); throw; }
+    link(new_node);
+    return true;
+  }
+
+public:
+
+  /* constructors */
+  ConcurrentQueue_() : ConcurrentQueue_(Alloc()) {}
+  //
+  explicit ConcurrentQueue_(const Alloc& alloc)
+    : m_alloc(alloc) {
+    node_ptr dummy = allocate_node();
+    m_head.store(dummy, std::memory_order_relaxed);
+    m_tail.store(dummy, std::memory_order_relaxed);
+  }
+  // shared between threads by reference, never copied or moved
+  ConcurrentQueue_(const ConcurrentQueue_&) = delete;
+  ConcurrentQueue_& operator=(const ConcurrentQueue_&) = delete;
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief check if the queue is empty, only a hint while other threads push or pop.
+  *        the head dummy is hazard protected, so it may be retired meanwhile
+  * @complexity O(1), retries under contention
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const -> bool
+  {
+    for (;;) {
+      node_ptr head = m_hazards.protect(0, m_head);
+      const bool empty = head->m_next.load(std::memory_order_acquire) == nullptr;
+      if (head != m_head.load(std::memory_order_seq_cst)) { continue; } // popped past meanwhile
+      m_hazards.clear(0);
+      return empty;
+    }
+  }
+
+  /**
+  * @brief add element at the back, lock-free
+  * @complexity O(1), retries under contention
+  * @param arg
+  * @return false if no node could be allocated, the queue is unchanged then
+  */
+  auto try_push(const T &arg) -> bool { return push_value(arg); }
+
+  /**
+  * @brief add element at the back, lock-free
+  * @complexity O(1), retries under contention
+  * @param arg
+  * @return false if no node could be allocated, `arg` is untouched then
+  */
+  auto try_push(T &&arg) -> bool { return push_value(std::move(arg)); }
+
+  /**
+  * @brief takes the front element into `out`, lock-free
+  * @complexity O(1), retries under contention
+  * @param out
+  * @return false if the queue was empty
+  * @note if moving into `out` throws, the element is destroyed and lost, the queue stays usable
+  */
+  auto try_pop(T &out) -> bool
+  {
+    for (;;) {
+      node_ptr head = m_hazards.protect(0, m_head);
+      node_ptr tail = m_tail.load(std::memory_order_acquire);
+      node_ptr next = m_hazards.protect(1, head->m_next);
+      if (head != m_head.load(std::memory_order_acquire)) { continue; } // `next` may be stale
+      if (next == nullptr) { m_hazards.clear_all(); return false; }
+      if (head == tail) { // tail lags behind a linked node, help it before moving past
+        m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+        continue;
+      }
+      if (m_head.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        // winning the exchange gives this thread sole claim on next's element, `next` is the new dummy
+        try { out = std::move(*next->data()); }
+        catch (...) { // `next` is the dummy now, its slot must be raw again either way
+          value_traits::destroy(m_alloc, next->data());
+          m_hazards.clear_all();
+          m_hazards.retire(head);
+          throw;
+        }
+        value_traits::destroy(m_alloc, next->data());
+        m_hazards.clear_all();
+        m_hazards.retire(head);
+        return true;
+      }
+    }
+  }
+
+  /* no thread may be using the queue any more */
+  ~ConcurrentQueue_() {
+    node_ptr dummy = m_head.load(std::memory_order_relaxed);
+    node_ptr it    = dummy->m_next.load(std::memory_order_relaxed);
+    free_node(dummy);
+    while (it != nullptr) {
+      node_ptr next = it->m_next.load(std::memory_order_relaxed);
+      value_traits::destroy(m_alloc, it->data());
+      free_node(it);
+      it = next;
+    }
+  }
+}; // end of class ConcurrentQueue_<T, Alloc>
+
+namespace pmr {
+  /* ConcurrentQueue_ whose nodes come from a ( synchronized ) std::pmr::memory_resource */
+  template <typename T>
+  using ConcurrentQueue_ = ::ConcurrentQueue_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // CONCURRENT_QUEUE_HPP
@@ -0,0 +1,260 @@
+/**
+* @file concurrent_set.hpp
+* @brief a lock-free sorted singly linked list of unique elements ( Harris / Michael ),
+*        for many threads searching, inserting and erasing at once
+*/
+
+#ifndef CONCURRENT_SET_HPP
+#define CONCURRENT_SET_HPP
+
+#include "hazard_pointers.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+/*
+* erasing is two steps: the low bit of the victim's m_next is set first ( logical
+* removal, no insert can link after it any more ), then the victim is unlinked from
+* its predecessor by whichever thread gets there first. every traversal unlinks the
+* marked nodes it passes and retires them through hazard pointers, three per thread:
+* predecessor, current and next. the allocator must be thread safe.
+*/
+template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T>>
+class ConcurrentSet_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- ConcurrentSet_<T, Compare, Alloc>: Alloc::value_type must be T");
+
+  class Node {
+  public:
+    std::atomic<Node*> m_next = {nullptr}; // low bit set: this node is being erased
+    T                  m_data;
+    //
+    template <typename U>
+    explicit Node(U&& data) : m_data(std::forward<U>(data)) {}
+  }; // end of class Node
+
+  static_assert(alignof(Node) >= 2, "- ConcurrentSet_: the mark needs a free low pointer bit");
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using link            = std::atomic<node_ptr>;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+
+  template <typename U>
+  auto allocate_node(U&& arg) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    try { node_traits::construct(alloc, new_node, std::forward<U>(arg)); }
+    catch (...) { node_traits::deallocate(alloc, new_node, 1); throw; }
+    return new_node;
+  }
+
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  struct reclaim {
+    ConcurrentSet_* m_set;
+    auto operator()(node_ptr node) const noexcept -> void { m_set->free_node(node); }
+  };
+
+  static auto is_marked(node_ptr p) noexcept -> bool { return (reinterpret_cast<std::uintptr_t>(p) & 1U) != 0; }
+  static auto marked(node_ptr p)   noexcept -> node_ptr { return reinterpret_cast<node_ptr>(reinterpret_cast<std::uintptr_t>(p) | 1U); }
+  static auto unmarked(node_ptr p) noexcept -> node_ptr { return reinterpret_cast<node_ptr>(reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t{1}); }
+
+  [[no_unique_address]] Alloc   m_alloc = {};
+  [[no_unique_address]] Compare m_comp  = {};
+  alignas(64) link m_head = {nullptr};
+  alignas(64) hazard::domain<Node, 3, reclaim> m_hazards {reclaim{this}};
+
+  /* where find() stopped: `*prev` linked to `cur` ( unmarked ) when it was checked */
+  struct position {
+    link*    prev;
+    node_ptr cur;
+  };
+
+  /**
+  * @brief finds the first node not less than `key`, unlinking marked nodes on the way;
+  *        `cur` and the node owning `prev` stay protected until the caller clears
+  * @complexity O(n)
+  * @return true if `cur` holds an element equal to `key`
+  */
+  auto find(const T& key, position& at) -> bool
+  {
+  retry:
+    std::size_t s_prev = 2, s_cur = 1, s_next = 0; // hazard slot of each role, rotated as we walk
+    link*    prev = &m_head;
+    node_ptr cur  = prev->load(std::memory_order_acquire);
+    m_hazards.set(s_cur, cur);
+    // the re-loads after publishing a hazard are seq_cst, like protect(): an acquire load
+    // may be ordered before the hazard store and miss a retire that scan() could not see
+    if (prev->load(std::memory_order_seq_cst) != cur) { goto retry; }
+    for (;;) {
+      if (cur == nullptr) { at = {prev, cur}; return false; }
+      node_ptr next = cur->m_next.load(std::memory_order_acquire);
+      m_hazards.set(s_next, unmarked(next));
+      // `cur` must still be linked from `prev` and `next` still its successor, or
+      // the hazard above may have been published too late
+      if (cur->m_next.load(std::memory_order_seq_cst) != next) { goto retry; }
+      if (prev->load(std::memory_order_seq_cst) != cur)       { goto retry; }
+      //
+      if (!is_marked(next)) {
+        if (!m_comp(cur->m_data, key)) {
+          at = {prev, cur};
+          return !m_comp(key, cur->m_data);
+        }
+        prev = &cur->m_next;
+        std::swap(s_prev, s_cur); // cur becomes the protected predecessor
+      } else {
+        node_ptr expected = cur;
+        if (!prev->compare_exchange_strong(expected, unmarked(next), std::memory_order_acq_rel)) { goto retry; }
+        m_hazards.retire(cur);
+      }
+      cur = unmarked(next);
+      std::swap(s_cur, s_next); // next is already protected in its slot
+    }
+  }
+
+  template <typename U>
+  auto insert_value(U&& arg) -> bool
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    position at {};
+    for (;;) {
+      if (find(new_node->m_data, at)) {
+        m_hazards.clear_all();
+        free_node(new_node);
+        return false;
+      }
+      new_node->m_next.store(at.cur, std::memory_order_relaxed);
+      node_ptr expected = at.cur;
+      if (at.prev->compare_exchange_strong(expected, new_node, std::memory_order_release, std::memory_order_relaxed)) {
+        m_hazards.clear_all();
+        return true;
+      }
+    }
+  }
+
+public:
+
+  /* constructors */
+  ConcurrentSet_() = default;
+  //
+  explicit ConcurrentSet_(const Compare& comp, const Alloc& alloc = Alloc())
+    : m_alloc(alloc), m_comp(comp) {}
+  //
+  explicit ConcurrentSet_(const Alloc& alloc)
+    : m_alloc(alloc) {}
+  // shared between threads by reference, never copied or moved
+  ConcurrentSet_(const ConcurrentSet_&) = delete;
+  ConcurrentSet_& operator=(const ConcurrentSet_&) = delete;
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief check if the set is empty, only a hint while other threads insert or erase
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool
+  {
+    return m_head.load(std::memory_order_acquire) == nullptr;
+  }
+
+  /**
+  * @brief search for a value, lock-free
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] auto contains(const T& target) -> bool
+  {
+    position at {};
+    const bool found = find(target, at);
+    m_hazards.clear_all();
+    return found;
+  }
+
+  /**
+  * @brief insert element at its sorted position unless an equal one is present, lock-free
+  * @complexity O(n)
+  * @param arg
+  * @return true if inserted
+  */
+  auto insert(const T& arg) -> bool { return insert_value(arg); }
+
+  /**
+  * @brief insert element at its sorted position unless an equal one is present, lock-free
+  * @complexity O(n)
+  * @param arg
+  * @return true if inserted
+  */
+  auto insert(T&& arg) -> bool { return insert_value(std::move(arg)); }
+
+  /**
+  * @brief remove the element equal to `target`, lock-free
+  * @complexity O(n)
+  * @param target
+  * @return true if this call removed it
+  */
+  auto erase(const T& target) -> bool
+  {
+    position at {};
+    for (;;) {
+      if (!find(target, at)) { m_hazards.clear_all(); return false; }
+      node_ptr next = at.cur->m_next.load(std::memory_order_acquire);
+      if (is_marked(next)) { continue; } // someone else is erasing it, find() will finish the job
+      if (!at.cur->m_next.compare_exchange_strong(next, marked(next), std::memory_order_acq_rel)) { continue; }
+      // logically gone; unlink it here or leave it to the next traversal
+      node_ptr expected = at.cur;
+      if (at.prev->compare_exchange_strong(expected, next, std::memory_order_acq_rel)) {
+        m_hazards.retire(at.cur);
+      } else {
+        find(target, at);
+      }
+      m_hazards.clear_all();
+      return true;
+    }
+  }
+
+  /* no thread may be using the set any more */
+  ~ConcurrentSet_() {
+    node_ptr it = m_head.load(std::memory_order_relaxed);
+    while (it != nullptr) {
+      node_ptr next = unmarked(it->m_next.load(std::memory_order_relaxed));
+      free_node(it);
+      it = next;
+    }
+  }
+}; // end of class ConcurrentSet_<T, Compare, Alloc>
+
+namespace pmr {
+  /* ConcurrentSet_ whose nodes come from a ( synchronized ) std::pmr::memory_resource */
+  template <typename T, typename Compare = std::less<T>>
+  using ConcurrentSet_ = ::ConcurrentSet_<T, Compare, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // CONCURRENT_SET_HPP
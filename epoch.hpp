@@ -0,0 +1,141 @@
+/**
+* @file epoch.hpp
+* @brief epoch based memory reclamation: readers only announce an epoch, writers free
+*        what they unlinked in batches once every reader has moved past it
+*/
+
+#ifndef EPOCH_HPP
+#define EPOCH_HPP
+
+#include "thread_registry.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/*
+* a reader pins the current global epoch for the length of its traversal: one load
+* and one store, never a wait. a node unlinked during epoch `e` is retired into the
+* retiring thread's bucket for `e`. the global epoch only advances from `e` to `e + 1`
+* once every pinned reader announced `e`, so when it reaches `e + 2` no reader can
+* still hold a node retired in `e` and that bucket is freed whole.
+*/
+namespace epoch {
+
+  /**
+  * @brief announced epochs and retired nodes for one container
+  * @tparam Node    the container's node type
+  * @tparam Reclaim callable freeing a Node* once it is safe
+  */
+  template <typename Node, typename Reclaim>
+  class domain
+  {
+    static constexpr std::uint64_t quiescent = 0; // not inside a read-side section
+    static constexpr std::size_t   buckets   = 3; // epochs e - 2, e - 1 and e
+    static constexpr std::size_t   batch     = 64; // retired nodes before trying to advance
+
+    /* one per thread index, only that thread touches the buckets */
+    struct alignas(64) record {
+      std::atomic<std::uint64_t> m_epoch = {quiescent};
+      std::uint32_t              m_nesting = {};
+      std::uint64_t              m_bucket_epoch[buckets] = {};
+      std::vector<Node*>         m_retired[buckets];
+    };
+
+    alignas(64) std::atomic<std::uint64_t> m_global = {1};
+    std::unique_ptr<record[]> m_records = std::make_unique<record[]>(reclaim::max_threads);
+    [[no_unique_address]] Reclaim m_reclaim;
+
+    auto free_bucket(std::vector<Node*>& bucket) noexcept -> void
+    {
+      for (Node* node : bucket) { m_reclaim(node); }
+      bucket.clear();
+    }
+
+    /* moves the global epoch on if every pinned reader has caught up with it */
+    auto try_advance() noexcept -> void
+    {
+      std::uint64_t global = m_global.load(std::memory_order_seq_cst);
+      const std::size_t threads = reclaim::threads_seen();
+      for (std::size_t t = 0; t < threads; ++t) {
+        const std::uint64_t e = m_records[t].m_epoch.load(std::memory_order_seq_cst);
+        if (e != quiescent && e != global) { return; }
+      }
+      m_global.compare_exchange_strong(global, global + 1, std::memory_order_seq_cst);
+    }
+
+  public:
+
+    /* read-side critical section, nodes reachable when it began stay allocated until it ends */
+    class guard {
+    private:
+      domain* m_domain = {nullptr};
+      //
+      friend class domain;
+      explicit guard(domain& d) noexcept : m_domain(&d) {}
+      //
+    public:
+      guard(guard&& other) noexcept : m_domain(std::exchange(other.m_domain, nullptr)) {}
+      guard(const guard&) = delete;
+      guard& operator=(const guard&) = delete;
+      guard& operator=(guard&&) = delete;
+      ~guard() { if (m_domain != nullptr) { m_domain->unpin(); } }
+    }; // end of class guard
+
+    explicit domain(Reclaim reclaim = {}) : m_reclaim(std::move(reclaim)) {}
+    domain(const domain&) = delete;
+    domain& operator=(const domain&) = delete;
+
+    /**
+    * @brief enters a read-side section, nesting is allowed
+    * @complexity O(1), wait-free
+    */
+    [[nodiscard]] auto pin() noexcept -> guard
+    {
+      record& own = m_records[reclaim::thread_index()];
+      if (own.m_nesting++ == 0) {
+        // seq_cst so try_advance() either sees this announcement or this reader sees the unlink
+        own.m_epoch.store(m_global.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+      }
+      return guard(*this);
+    }
+
+    auto unpin() noexcept -> void
+    {
+      record& own = m_records[reclaim::thread_index()];
+      if (--own.m_nesting == 0) { own.m_epoch.store(quiescent, std::memory_order_release); }
+    }
+
+    /**
+    * @brief hands an unlinked node over, freed two epochs later in a batch
+    * @complexity amortized O(1) per node, O(threads) per batch
+    */
+    auto retire(Node* node) -> void
+    {
+      record& own = m_records[reclaim::thread_index()];
+      const std::uint64_t global = m_global.load(std::memory_order_seq_cst);
+      const std::size_t   b      = global % buckets;
+      if (own.m_bucket_epoch[b] != global) {
+        // the bucket still holds epoch global - 3 or older, nobody can reach those any more
+        free_bucket(own.m_retired[b]);
+        own.m_bucket_epoch[b] = global;
+      }
+      own.m_retired[b].push_back(node);
+      if (own.m_retired[b].size() % batch == 0) { try_advance(); }
+    }
+
+    /* frees everything retired, no thread may be using the container any more */
+    ~domain()
+    {
+      for (std::size_t t = 0; t < reclaim::max_threads; ++t) {
+        for (auto& bucket : m_records[t].m_retired) { free_bucket(bucket); }
+      }
+    }
+  }; // end of class domain
+
+} // namespace epoch
+
+#endif // EPOCH_HPP
@@ -0,0 +1,131 @@
+/**
+* @file hazard_pointers.hpp
+* @brief hazard pointer based memory reclamation for the lock-free containers
+*/
+
+#ifndef HAZARD_POINTERS_HPP
+#define HAZARD_POINTERS_HPP
+
+#include "thread_registry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/*
+* a thread publishes the nodes it is about to dereference in its hazard slots; a
+* removed node is retired instead of freed, and retired nodes are only reclaimed
+* once no slot of any thread holds them. every container owns its own domain, so
+* reclamation never outlives the allocator the nodes came from.
+*/
+namespace hazard {
+
+  /**
+  * @brief hazard slots and retired nodes for one container
+  * @tparam Node    the container's node type
+  * @tparam Slots   hazard pointers each thread may hold at once
+  * @tparam Reclaim callable freeing a Node* once it is safe
+  */
+  template <typename Node, std::size_t Slots, typename Reclaim>
+  class domain
+  {
+    static_assert(Slots > 0, "- hazard::domain: needs at least one slot per thread");
+
+    /* one per thread index, only that thread touches `m_retired` */
+    struct alignas(64) record { // a cache line each, slots are stored to constantly
+      std::atomic<Node*> m_hazards[Slots] = {};
+      std::vector<Node*> m_retired;
+      std::vector<Node*> m_scratch; // hazards seen by the last scan
+    };
+
+    std::unique_ptr<record[]> m_records = std::make_unique<record[]>(reclaim::max_threads);
+    [[no_unique_address]] Reclaim m_reclaim;
+
+    /* frees every node the calling thread retired that no thread still protects */
+    auto scan(record& own) -> void
+    {
+      const std::size_t threads = reclaim::threads_seen();
+      own.m_scratch.clear();
+      for (std::size_t t = 0; t < threads; ++t) {
+        for (const auto& slot : m_records[t].m_hazards) {
+          if (Node* p = slot.load(std::memory_order_seq_cst); p != nullptr) { own.m_scratch.push_back(p); }
+        }
+      }
+      std::sort(own.m_scratch.begin(), own.m_scratch.end());
+      //
+      auto keep = own.m_retired.begin();
+      for (Node* node : own.m_retired) {
+        if (std::binary_search(own.m_scratch.begin(), own.m_scratch.end(), node)) { *keep++ = node; }
+        else                                                                      { m_reclaim(node); }
+      }
+      own.m_retired.erase(keep, own.m_retired.end());
+    }
+
+  public:
+
+    explicit domain(Reclaim reclaim = {}) : m_reclaim(std::move(reclaim)) {}
+    domain(const domain&) = delete;
+    domain& operator=(const domain&) = delete;
+
+    /**
+    * @brief loads `src` into hazard slot `slot` so the node it names can be dereferenced
+    *        until the slot is cleared
+    * @complexity O(1) expected, retries while `src` keeps changing
+    */
+    auto protect(const std::size_t slot, const std::atomic<Node*>& src) -> Node*
+    {
+      std::atomic<Node*>& hazard = m_records[reclaim::thread_index()].m_hazards[slot];
+      Node* p = src.load(std::memory_order_relaxed);
+      for (;;) {
+        hazard.store(p, std::memory_order_seq_cst);
+        Node* again = src.load(std::memory_order_seq_cst);
+        if (again == p) { return p; }
+        p = again;
+      }
+    }
+
+    /* publishes an already known pointer, the caller re-validates it afterwards */
+    auto set(const std::size_t slot, Node* p) -> void
+    {
+      m_records[reclaim::thread_index()].m_hazards[slot].store(p, std::memory_order_seq_cst);
+    }
+
+    auto clear(const std::size_t slot) -> void
+    {
+      m_records[reclaim::thread_index()].m_hazards[slot].store(nullptr, std::memory_order_release);
+    }
+
+    auto clear_all() -> void
+    {
+      for (auto& slot : m_records[reclaim::thread_index()].m_hazards) { slot.store(nullptr, std::memory_order_release); }
+    }
+
+    /**
+    * @brief hands an unlinked node over for reclamation, scanning once enough piled up
+    * @complexity amortized O(1)
+    */
+    auto retire(Node* node) -> void
+    {
+      record& own = m_records[reclaim::thread_index()];
+      own.m_retired.push_back(node);
+      const std::size_t threshold =
+        std::max<std::size_t>(64, 2 * Slots * reclaim::threads_seen());
+      if (own.m_retired.size() >= threshold) { scan(own); }
+    }
+
+    /* reclaims everything retired, no thread may be using the container any more */
+    ~domain()
+    {
+      for (std::size_t t = 0; t < reclaim::max_threads; ++t) {
+        for (Node* node : m_records[t].m_retired) { m_reclaim(node); }
+      }
+    }
+  }; // end of class domain
+
+} // namespace hazard
+
+#endif // HAZARD_POINTERS_HPP
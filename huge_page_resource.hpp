@@ -0,0 +1,178 @@
+/**
+* @file huge_page_resource.hpp
+* @brief a std::pmr::memory_resource carving allocations out of large regions that are
+*        advised to be backed by transparent huge pages, for pmr::List_ and friends
+*/
+
+#ifndef HUGE_PAGE_RESOURCE_HPP
+#define HUGE_PAGE_RESOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+  #include <sys/mman.h>
+  #define HUGE_PAGE_RESOURCE_MMAP 1
+#else
+  #define HUGE_PAGE_RESOURCE_MMAP 0
+#endif
+
+/*
+* nodes of a list that outgrows the TLB reach of 4 KiB pages spread over so many pages
+* that a traversal misses the TLB on most steps. this resource maps regions aligned to
+* 2 MiB and asks the kernel to back them with huge pages ( madvise(MADV_HUGEPAGE) ), then
+* hands out memory from them by bumping a pointer. when the advice is refused, or the
+* system has no mmap, the regions stay on normal pages and everything else is unchanged.
+* a region mmap can not provide is taken from the upstream resource instead.
+*
+* like std::pmr::monotonic_buffer_resource, deallocate() is a no-op and memory goes back
+* on release() or destruction. put a pool resource on top for lists that pop and push:
+*
+*   huge_page_resource huge;
+*   std::pmr::unsynchronized_pool_resource pool(&huge);
+*   pmr::List_<long> list(&pool);
+*
+* not thread safe, use std::pmr::synchronized_pool_resource on top for shared lists.
+*/
+class huge_page_resource : public std::pmr::memory_resource
+{
+public:
+
+  static constexpr std::size_t huge_page_size = std::size_t{1} << 21; // 2 MiB on x86-64 and arm64
+
+private:
+
+  struct region {
+    std::byte*  m_base;
+    std::size_t m_bytes;
+    bool        m_upstream_owned; // from m_upstream, not mapped
+  };
+
+  std::pmr::memory_resource* m_upstream;  // used without mmap, or when mmap fails
+  std::size_t                m_region_bytes;
+  std::vector<region>        m_regions;
+  std::byte*                 m_next = {nullptr};
+  std::byte*                 m_end  = {nullptr};
+  std::size_t                m_advised = {}; // bytes the kernel accepted MADV_HUGEPAGE for
+
+  static constexpr auto round_up(const std::size_t bytes, const std::size_t to) noexcept -> std::size_t
+  {
+    return (bytes + to - 1) / to * to;
+  }
+
+  /* a region of at least `bytes`, aligned to huge_page_size */
+  auto map_region(const std::size_t bytes) -> region
+  {
+    const std::size_t size = round_up(bytes, huge_page_size);
+#if HUGE_PAGE_RESOURCE_MMAP
+    // over-map by one huge page and trim both ends to get the alignment THP needs
+    const std::size_t mapped = size + huge_page_size;
+    void* raw = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) { // out of address space or mappings: normal pages from upstream
+      return {static_cast<std::byte*>(m_upstream->allocate(size, huge_page_size)), size, true};
+    }
+    const auto start   = reinterpret_cast<std::uintptr_t>(raw);
+    const auto aligned = round_up(start, huge_page_size);
+    if (aligned != start) { ::munmap(raw, aligned - start); }
+    if (const std::size_t tail = start + mapped - (aligned + size); tail != 0) {
+      ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+    }
+    auto* base = reinterpret_cast<std::byte*>(aligned);
+  #ifdef MADV_HUGEPAGE
+    if (::madvise(base, size, MADV_HUGEPAGE) == 0) { m_advised += size; }
+  #endif
+    return {base, size, false};
+#else
+    return {static_cast<std::byte*>(m_upstream->allocate(size, huge_page_size)), size, true};
+#endif
+  }
+
+  auto unmap_region(const region& r) noexcept -> void
+  {
+    if (r.m_upstream_owned) { m_upstream->deallocate(r.m_base, r.m_bytes, huge_page_size); return; }
+#if HUGE_PAGE_RESOURCE_MMAP
+    ::munmap(r.m_base, r.m_bytes);
+#endif
+  }
+
+protected:
+
+  auto do_allocate(const std::size_t bytes, const std::size_t alignment) -> void* override
+  {
+    auto next = reinterpret_cast<std::uintptr_t>(m_next);
+    next      = round_up(next, alignment);
+    if (m_next == nullptr || next + bytes > reinterpret_cast<std::uintptr_t>(m_end)) {
+      m_regions.reserve(m_regions.size() + 1);
+      const region r = map_region(std::max(m_region_bytes, bytes + alignment));
+      m_regions.push_back(r);
+      m_next = r.m_base;
+      m_end  = r.m_base + r.m_bytes;
+      next   = round_up(reinterpret_cast<std::uintptr_t>(m_next), alignment);
+    }
+    m_next = reinterpret_cast<std::byte*>(next + bytes);
+    return reinterpret_cast<void*>(next);
+  }
+
+  auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+  {
+    return this == &other;
+  }
+
+public:
+
+  /* constructors */
+  /**
+  * @param region_bytes : size of every region mapped, rounded up to whole huge pages
+  * @param upstream : where regions come from when the system has no mmap or mmap fails
+  */
+  explicit huge_page_resource(const std::size_t region_bytes = std::size_t{64} << 20,
+                              std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+    : m_upstream(upstream), m_region_bytes(round_up(std::max<std::size_t>(region_bytes, 1), huge_page_size)) {}
+  //
+  huge_page_resource(const huge_page_resource&) = delete;
+  huge_page_resource& operator=(const huge_page_resource&) = delete;
+
+  /*@ methods: */
+  /**
+  * @brief gives every region back, all memory handed out is invalid afterwards
+  * @complexity O(regions)
+  */
+  auto release() noexcept -> void
+  {
+    for (const region& r : m_regions) { unmap_region(r); }
+    m_regions.clear();
+    m_next    = nullptr;
+    m_end     = nullptr;
+    m_advised = {};
+  }
+
+  /**
+  * @brief bytes held in regions so far, mapped or taken from upstream
+  * @complexity O(regions)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto mapped_bytes() const noexcept -> std::size_t
+  {
+    std::size_t total = {};
+    for (const region& r : m_regions) { total += r.m_bytes; }
+    return total;
+  }
+
+  /**
+  * @brief bytes the kernel accepted the huge page advice for, 0 means normal pages only.
+  *        the kernel still decides per page whether a huge page is available
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto advised_bytes() const noexcept -> std::size_t { return m_advised; }
+
+  ~huge_page_resource() override { release(); }
+}; // end of class huge_page_resource
+
+#endif // HUGE_PAGE_RESOURCE_HPP
@@ -0,0 +1,593 @@
+/**
+* @file indexed_list.hpp
+* @brief a singly linked list with a side hash index from value to its first node,
+*        search() in O(1) and locate() in O(1) while only the ends change
+*/
+
+#ifndef INDEXED_LIST_HPP
+#define INDEXED_LIST_HPP
+
+#include "list.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+* the index is an open addressing table ( linear probing, backward shift erase ) with
+* one slot per distinct value: the value, how many nodes hold it and the first of them.
+* positions come from a sequence number per node: push_back numbers after the tail,
+* push_front before the head, so position = seq - head's seq for as long as only the
+* ends change. push_at / pop_at in the middle mark the numbering stale, the next
+* locate() renumbers the whole list once. when the first node holding a duplicated
+* value is popped, its slot forgets which node comes next and the next locate() of
+* that value walks to it.
+*
+* memory: every node carries an extra 8 byte sequence number, the table keeps
+* sizeof(Slot) = sizeof(T) + 12 ( rounded up to alignment ) per slot at a load factor
+* of at most 3/4, so between 1.33x and 2.67x slots per distinct value.
+* update cost: one hash and probe per push / pop, plus a doubling rehash when full.
+* elements are only reachable as const, changing one in place would corrupt the index.
+*/
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>,
+          typename Alloc = std::allocator<T>>
+class IndexedList_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- IndexedList_<T, Hash, KeyEqual, Alloc>: Alloc::value_type must be T");
+
+  class Node {
+  public:
+    T            m_data;
+    Node*        m_next = {nullptr};
+    std::int64_t m_seq  = {}; // position + head's seq while the numbering is fresh
+    //
+    template <typename U>
+    explicit Node(U&& data) : m_data(std::forward<U>(data)) {}
+  }; // end of class Node
+
+  class Slot {
+  public:
+    Node*         m_first = {nullptr}; // null with m_count > 0: not known, walk to find it
+    std::uint32_t m_count = {};        // 0: slot unused
+    T             m_key;               // assigned when the slot is claimed
+  }; // end of class Slot
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+  using slot_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  template <typename U>
+  auto allocate_node(U&& arg) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    try { node_traits::construct(alloc, new_node, std::forward<U>(arg)); }
+    catch (...) { node_traits::deallocate(alloc, new_node, 1); throw; }
+    return new_node;
+  }
+
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  node_ptr    m_head = {nullptr};
+  node_ptr    m_tail = {nullptr};
+  std::size_t m_size = {};
+  bool        m_stale = {false}; // sequence numbers no longer match positions
+  [[no_unique_address]] Alloc    m_alloc = {};
+  [[no_unique_address]] Hash     m_hash  = {};
+  [[no_unique_address]] KeyEqual m_equal = {};
+  std::vector<Slot, slot_allocator> m_slots {slot_allocator(m_alloc)}; // power of two, or empty
+  std::size_t m_used = {}; // slots with m_count > 0
+
+protected:
+  T _failed_ = {};
+
+private:
+
+  /*@ the index: */
+  [[nodiscard]] auto home(const T& key) const noexcept -> std::size_t
+  {
+    return m_hash(key) & (m_slots.size() - 1);
+  }
+
+  /* slot holding `key`, or npos */
+  [[nodiscard]] auto find_slot(const T& key) const -> std::size_t
+  {
+    if (m_slots.empty()) { return npos; }
+    for (std::size_t i = home(key); ; i = (i + 1) & (m_slots.size() - 1)) {
+      if (m_slots[i].m_count == 0)            { return npos; }
+      if (m_equal(m_slots[i].m_key, key))     { return i; }
+    }
+  }
+
+  /* slot for `key`, claiming an unused one if it is not indexed yet */
+  auto claim_slot(const T& key) -> Slot&
+  {
+    if ((m_used + 1) * 4 > m_slots.size() * 3) { rehash(m_slots.empty() ? 16 : m_slots.size() * 2); }
+    std::size_t i = home(key);
+    for ( ; m_slots[i].m_count != 0; i = (i + 1) & (m_slots.size() - 1)) {
+      if (m_equal(m_slots[i].m_key, key)) { return m_slots[i]; }
+    }
+    m_slots[i].m_key = key;
+    ++m_used;
+    return m_slots[i];
+  }
+
+  auto rehash(const std::size_t capacity) -> void
+  {
+    std::vector<Slot, slot_allocator> old(capacity, slot_allocator(m_alloc));
+    old.swap(m_slots); // `old` now holds the previous table
+    for (auto& slot : old) {
+      if (slot.m_count == 0) { continue; }
+      std::size_t i = home(slot.m_key);
+      while (m_slots[i].m_count != 0) { i = (i + 1) & (m_slots.size() - 1); }
+      m_slots[i] = std::move(slot);
+    }
+  }
+
+  /* empties slot `i`, pulling later members of its probe run back so no gap splits a run */
+  auto erase_slot(std::size_t i) -> void
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    for (std::size_t j = (i + 1) & mask; m_slots[j].m_count != 0; j = (j + 1) & mask) {
+      const std::size_t h = home(m_slots[j].m_key);
+      // j's entry may fill the hole at i only if i lies on its probe path h .. j
+      if (((j - h) & mask) >= ((j - i) & mask)) {
+        m_slots[i] = std::move(m_slots[j]);
+        i = j;
+      }
+    }
+    m_slots[i].m_count = 0;
+    m_slots[i].m_first = nullptr;
+    --m_used;
+  }
+
+  enum class placement { front, back, middle };
+
+  /* records a node about to be linked at `where` */
+  auto index_node(node_ptr node, const placement where) -> void
+  {
+    Slot& slot = claim_slot(node->m_data);
+    if (slot.m_count++ == 0 || where == placement::front) { slot.m_first = node; }
+    else if (where == placement::middle)                  { slot.m_first = nullptr; } // order unknown
+  }
+
+  /* forgets a node about to be unlinked */
+  auto unindex_node(node_ptr node) -> void
+  {
+    const std::size_t i = find_slot(node->m_data);
+    Slot& slot = m_slots[i];
+    if (--slot.m_count == 0)        { erase_slot(i); }
+    else if (slot.m_first == node)  { slot.m_first = nullptr; }
+  }
+
+  /* renumbers every node from 0 and finds every forgotten first node on the way */
+  auto renumber() -> void
+  {
+    std::int64_t seq = 0;
+    for (node_ptr it = m_head; it != nullptr; it = it->m_next) {
+      it->m_seq = seq++;
+      Slot& slot = m_slots[find_slot(it->m_data)];
+      if (slot.m_first == nullptr) { slot.m_first = it; }
+    }
+    m_stale = false;
+  }
+
+  /* the first node holding `target`, or null */
+  auto first_node(const T& target) -> node_ptr
+  {
+    const std::size_t i = find_slot(target);
+    if (i == npos) { return nullptr; }
+    if (m_slots[i].m_first == nullptr) {
+      if (m_stale) { renumber(); }
+      else {
+        node_ptr it = m_head;
+        while (!m_equal(it->m_data, target)) { it = it->m_next; }
+        m_slots[i].m_first = it;
+      }
+    }
+    return m_slots[i].m_first;
+  }
+
+  /*@ the chain: */
+  template <typename U>
+  auto link_back(U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    new_node->m_seq   = m_tail != nullptr ? m_tail->m_seq + 1 : 0;
+    try { index_node(new_node, placement::back); } catch (...) { free_node(new_node); throw; }
+    if (m_tail == nullptr) { m_head = new_node; } else { m_tail->m_next = new_node; }
+    m_tail = new_node;
+    ++m_size;
+  }
+
+  template <typename U>
+  auto link_front(U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    new_node->m_seq   = m_head != nullptr ? m_head->m_seq - 1 : 0;
+    try { index_node(new_node, placement::front); } catch (...) { free_node(new_node); throw; }
+    new_node->m_next = m_head;
+    m_head = new_node;
+    if (m_tail == nullptr) { m_tail = new_node; }
+    ++m_size;
+  }
+
+  template <typename U>
+  auto link_at(const std::size_t pos, U&& arg) -> void
+  {
+    if (pos > size()) [[unlikely]] { empty_list(); return; }
+    if (pos == 0)                  { link_front(std::forward<U>(arg)); return; }
+    if (pos == size())             { link_back(std::forward<U>(arg)); return; }
+    node_ptr prev = m_head;
+    for (std::size_t i = 1; i < pos; ++i) { prev = prev->m_next; }
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    m_stale = true;
+    try { index_node(new_node, placement::middle); } catch (...) { free_node(new_node); throw; }
+    new_node->m_next = prev->m_next;
+    prev->m_next     = new_node;
+    ++m_size;
+  }
+
+  auto destroy_nodes() noexcept -> void
+  {
+    while ( m_head != nullptr ) {
+      node_ptr next = m_head->m_next;
+      free_node(m_head);
+      m_head = next;
+    }
+    m_tail  = nullptr;
+    m_size  = {};
+    m_stale = false;
+    m_slots.clear();
+    m_used  = {};
+  }
+
+public:
+
+  /* read-only forward iterator, elements are index keys */
+  class const_iterator {
+  private:
+    const Node* node_ptr_ {nullptr};
+    //
+    friend class IndexedList_;
+    //
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+    //
+    constexpr const_iterator() noexcept = default;
+    constexpr const_iterator(const Node* newPtr) noexcept : node_ptr_(newPtr) {}
+    //
+    constexpr bool operator==(const const_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const const_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
+    }
+    // pre increment
+    constexpr const_iterator& operator++() noexcept {
+      node_ptr_ = node_ptr_->m_next;
+      return *this;
+    }
+    // post increment
+    constexpr const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      node_ptr_ = node_ptr_->m_next;
+      return old;
+    }
+  }; // end of class const_iterator
+
+  using iterator = const_iterator;
+
+  [[nodiscard]] auto begin()  const noexcept -> const_iterator { return const_iterator(m_head); }
+  [[nodiscard]] auto end()    const noexcept -> const_iterator { return const_iterator(nullptr); }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] auto cend()   const noexcept -> const_iterator { return end(); }
+
+  /* constructors */
+  IndexedList_() = default;
+  //
+  explicit IndexedList_(const Alloc& alloc)
+    : m_alloc(alloc) {}
+  //
+  IndexedList_(IndexedList_&& lh) noexcept
+    : m_head(std::exchange(lh.m_head, nullptr)), m_tail(std::exchange(lh.m_tail, nullptr)),
+      m_size(std::exchange(lh.m_size, 0)), m_stale(std::exchange(lh.m_stale, false)),
+      m_alloc(lh.m_alloc), m_hash(lh.m_hash), m_equal(lh.m_equal),
+      m_slots(std::move(lh.m_slots)), m_used(std::exchange(lh.m_used, 0)) {}
+  //
+  IndexedList_(const IndexedList_& lh)
+    : m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(lh.m_alloc)),
+      m_hash(lh.m_hash), m_equal(lh.m_equal) {
+    for (const auto& i : lh) { push_back(i); }
+  }
+  //
+  explicit IndexedList_(const std::initializer_list<T>& arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    for (const auto& i : arg) { push_back(i); }
+  }
+
+  //
+  IndexedList_& operator=(const IndexedList_& lh) {
+    if (this != &lh) {
+      destroy_nodes();
+      m_hash  = lh.m_hash;
+      m_equal = lh.m_equal;
+      for (const auto& i : lh) { push_back(i); }
+    }
+    return *this;
+  }
+
+  //
+  IndexedList_& operator=(IndexedList_&& lh) noexcept(std::allocator_traits<Alloc>::is_always_equal::value) {
+    if (this != &lh) {
+      destroy_nodes();
+      m_hash  = lh.m_hash; // the slots taken over were placed by these
+      m_equal = lh.m_equal;
+      if (std::allocator_traits<Alloc>::is_always_equal::value || m_alloc == lh.m_alloc) {
+        m_head  = std::exchange(lh.m_head, nullptr);
+        m_tail  = std::exchange(lh.m_tail, nullptr);
+        m_size  = std::exchange(lh.m_size, 0);
+        m_stale = std::exchange(lh.m_stale, false);
+        m_slots = std::move(lh.m_slots);
+        m_used  = std::exchange(lh.m_used, 0);
+        lh.m_slots.clear();
+      } else {
+        for (const auto& i : lh) { push_back(i); }
+        lh.destroy_nodes();
+      }
+    }
+    return *this;
+  }
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes and index slots are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_head == nullptr; }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+  /**
+  * @brief bytes the index adds on top of a List_ of the same elements
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto index_bytes() const noexcept -> std::size_t
+  {
+    return m_slots.capacity() * sizeof(Slot) + m_size * sizeof(std::int64_t);
+  }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  * @return const T&
+  */
+  [[nodiscard]] auto front() const -> const T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_head->m_data;
+  }
+
+  /**
+  * @brief return last element
+  * @complexity O(1)
+  * @return const T&
+  */
+  [[nodiscard]] auto back() const -> const T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_tail->m_data;
+  }
+
+  /**
+  * @brief return element at given position
+  * @complexity O(n)
+  * @param pos
+  * @return const T&
+  */
+  [[nodiscard]] auto at(const std::size_t pos) const -> const T &
+  {
+    if (pos >= size()) [[unlikely]] { empty_list(); return _failed_; }
+    auto it = begin();
+    for (std::size_t i = 0; i < pos; ++i) { ++it; }
+    return *it;
+  }
+
+  auto print() const -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for ( const auto& i : *this ) { std::cout << i << ' '; }
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1) amortized
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { link_back(arg); }
+  auto push_back(T &&arg)      -> void { link_back(std::move(arg)); }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1) amortized
+  * @param arg
+  */
+  auto push_front(const T &arg) -> void { link_front(arg); }
+  auto push_front(T &&arg)      -> void { link_front(std::move(arg)); }
+
+  /**
+  * @brief add element at given position, a middle position makes the next locate() O(n)
+  * @complexity O(pos)
+  * @param pos
+  * @param arg
+  */
+  auto push_at(const std::size_t pos, const T &arg) -> void { link_at(pos, arg); }
+  auto push_at(const std::size_t pos, T &&arg)      -> void { link_at(pos, std::move(arg)); }
+
+  /**
+  * @brief remove first element
+  * @complexity O(1)
+  */
+  auto pop_front() -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    node_ptr first = m_head;
+    unindex_node(first);
+    m_head = first->m_next;
+    if (m_head == nullptr) { m_tail = nullptr; m_stale = false; }
+    --m_size;
+    free_node(first);
+  }
+
+  /**
+  * @brief remove last element
+  * @complexity O(n)
+  */
+  auto pop_back() -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    if (size() == 1)              { pop_front(); return; }
+    node_ptr last = m_head;
+    while (last->m_next != m_tail) { last = last->m_next; }
+    unindex_node(m_tail);
+    free_node(m_tail);
+    m_tail         = last;
+    m_tail->m_next = nullptr;
+    --m_size;
+  }
+
+  /**
+  * @brief remove element at given position, a middle position makes the next locate() O(n)
+  * @complexity O(pos)
+  */
+  auto pop_at(const std::size_t pos) -> void
+  {
+    if (pos >= size()) [[unlikely]] { empty_list(); return; }
+    if (pos == 0)                   { pop_front(); return; }
+    node_ptr prev = m_head;
+    for (std::size_t i = 1; i < pos; ++i) { prev = prev->m_next; }
+    node_ptr victim = prev->m_next;
+    unindex_node(victim);
+    prev->m_next = victim->m_next;
+    if (victim == m_tail) { m_tail = prev; }
+    else                  { m_stale = true; }
+    --m_size;
+    free_node(victim);
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(1) expected
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    return find_slot(target) != npos;
+  }
+
+  /**
+  * @brief returns how many elements equal `target`
+  * @complexity O(1) expected
+  * @param target
+  */
+  [[nodiscard]] auto count(const T & target) const -> std::size_t
+  {
+    const std::size_t i = find_slot(target);
+    return i == npos ? 0 : m_slots[i].m_count;
+  }
+
+  /**
+  * @brief the first node holding `target`, or end()
+  * @complexity O(1) expected, O(n) once after a middle push_at/pop_at or after
+  *             popping the first of several equal elements
+  * @param target
+  */
+  [[nodiscard]] auto find(const T & target) -> const_iterator { return const_iterator(first_node(target)); }
+
+  /**
+  * @brief returns the position of the first node containing target, or -1
+  * @complexity same as find()
+  * @param target
+  * @return std::int64_t
+  */
+  [[nodiscard]] auto locate(const T& target) -> std::int64_t
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return -1; }
+    node_ptr node = first_node(target);
+    if (node == nullptr) { return -1; }
+    if (m_stale) { renumber(); }
+    return node->m_seq - m_head->m_seq;
+  }
+
+  /**
+  * @brief erases the list and its index
+  * @complexity O(n)
+  */
+  auto clear() -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    destroy_nodes();
+  }
+
+  ~IndexedList_() {
+    destroy_nodes();
+  }
+}; // end of class IndexedList_<T, Hash, KeyEqual, Alloc>
+
+namespace pmr {
+  /* IndexedList_ whose nodes and index come from a std::pmr::memory_resource */
+  template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+  using IndexedList_ = ::IndexedList_<T, Hash, KeyEqual, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // INDEXED_LIST_HPP
@@ -8,140 +8,719 @@
 #ifndef LIST_HPP
 #define LIST_HPP
 
-#define XORSWAP(a, b) ((a) ^= (b), (b) ^= (a), (a) ^= (b))
-#define MYSWAP(a, b) (&(a) == &b) ? a : XORSWAP(a, b)
-
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 constexpr auto empty_list = []() -> void {
   std::cerr << "- list is empty...";
 };
 
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class List_
 {
   class Node {
   public:
-    T m_data = {};
-    std::shared_ptr<Node> m_next = {nullptr};
+    T     m_data;
+    Node* m_next = {nullptr}; // owned by the list, never shared
+    //
+    template <typename ...Args>
+    constexpr explicit Node(std::in_place_t, Args&& ...args) : m_data(std::forward<Args>(args)...) {}
   }; // end of class Node
 
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- List_<T, Alloc>: Alloc::value_type must be T");
+
+public:
+
+  using allocator_type = Alloc;
+
 private:
 
-  using sh_ptr = std::shared_ptr<Node>;
-  constexpr sh_ptr allocate_node() const noexcept { return std::make_shared<Node>(); }
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+
+  /* the element is constructed from `args` in place, never default constructed first */
+  template <typename ...Args>
+  constexpr auto allocate_node(Args&& ...args) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = take_spare();
+    if (new_node == nullptr) { new_node = node_traits::allocate(alloc, 1); }
+    try { node_traits::construct(alloc, new_node, std::in_place, std::forward<Args>(args)...); }
+    catch (...) { if (!recycle(new_node)) { node_traits::deallocate(alloc, new_node, 1); } throw; }
+    return new_node;
+  }
+
+  constexpr auto free_node(node_ptr node) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    if (m_slabs != nullptr && give_back(node)) { return; } // slab storage is never kept as a spare
+    if (recycle(node)) { return; }
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  /* a spare node's storage holds nothing but the link to the next spare */
+  static auto spare_link(const node_ptr spare) noexcept -> node_ptr&
+  {
+    return *std::launder(reinterpret_cast<node_ptr*>(spare));
+  }
+
+  /* keeps the storage of a destroyed node for the next allocate_node(), false when full */
+  auto recycle(const node_ptr node) noexcept -> bool
+  {
+    if (m_spare_count == m_max_spares) { return false; }
+    ::new (static_cast<void*>(node)) node_ptr(m_spares);
+    m_spares = node;
+    ++m_spare_count;
+    return true;
+  }
+
+  /* storage of a recycled node, null when there is none */
+  auto take_spare() noexcept -> node_ptr
+  {
+    if (m_spares == nullptr) { return nullptr; }
+    node_ptr spare = m_spares;
+    m_spares = spare_link(spare);
+    --m_spare_count;
+    return spare;
+  }
+
+  /* deallocates spares until at most `keep` are left */
+  auto free_spares(const std::size_t keep = 0) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    while (m_spare_count > keep) {
+      node_ptr spare = m_spares;
+      m_spares = spare_link(spare);
+      --m_spare_count;
+      node_traits::deallocate(alloc, spare, 1);
+    }
+  }
+
+  /*
+  * `m_count` nodes taken by one allocation of a bulk insert, deallocated whole once its
+  * `m_live` nodes were all freed. nodes move between lists ( append, split_at, .. ), so
+  * every list that may hold nodes of a slab keeps a slab_ref to it and `m_owners` counts
+  * those refs, the last one dropped frees the record. lists sharing a slab may live on
+  * different threads, hence the atomic counters
+  */
+  struct slab {
+    node_ptr                 m_base;
+    std::size_t              m_count;
+    std::atomic<std::size_t> m_live;
+    std::atomic<std::size_t> m_owners;
+  };
+
+  /* one per slab the list may hold nodes of, chained from m_slabs */
+  struct slab_ref {
+    slab*       m_slab;
+    slab_ref*   m_next;
+    std::size_t m_freed; // nodes destroy_slabbed() freed and not yet taken off m_live
+  };
+
+  using slab_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<slab>;
+  using slab_traits     = std::allocator_traits<slab_allocator>;
+  using ref_allocator   = typename std::allocator_traits<Alloc>::template rebind_alloc<slab_ref>;
+  using ref_traits      = std::allocator_traits<ref_allocator>;
+
+  /* frees `ref`, and its slab record when no other list refers to it any more */
+  auto drop_slab_ref(slab_ref* ref) noexcept -> void
+  {
+    if (ref->m_slab->m_owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      slab_allocator records(m_alloc);
+      slab_traits::destroy(records, ref->m_slab);
+      slab_traits::deallocate(records, ref->m_slab, 1);
+    }
+    ref_allocator refs(m_alloc);
+    ref_traits::deallocate(refs, ref, 1);
+  }
+
+  auto drop_slab_refs() noexcept -> void
+  {
+    while (m_slabs != nullptr) { drop_slab_ref(std::exchange(m_slabs, m_slabs->m_next)); }
+  }
+
+  /*
+  * deallocates a destroyed node that came from one of the list's slabs, or the whole slab
+  * once it was the last live one; false when the node was allocated on its own. refs to
+  * slabs another list freed meanwhile are dropped on the way: their range may be reused
+  */
+  auto give_back(const node_ptr node) noexcept -> bool
+  {
+    for (slab_ref** link = &m_slabs; *link != nullptr; ) {
+      slab_ref* ref = *link;
+      slab&     s   = *ref->m_slab;
+      if (s.m_live.load(std::memory_order_acquire) == 0) { *link = ref->m_next; drop_slab_ref(ref); continue; }
+      if (!holds(s, node)) { link = &ref->m_next; continue; }
+      if (s.m_live.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        node_allocator alloc(m_alloc);
+        node_traits::deallocate(alloc, s.m_base, s.m_count);
+        *link = ref->m_next;
+        drop_slab_ref(ref);
+      }
+      return true;
+    }
+    return false;
+  }
+
+  [[nodiscard]] static auto holds(const slab& s, const node_ptr node) noexcept -> bool
+  {
+    return !std::less<>{}(node, s.m_base) && std::less<>{}(node, s.m_base + s.m_count);
+  }
+
+  /* the ref to the live slab holding `node`, null when it was allocated on its own */
+  [[nodiscard]] auto slab_of(const node_ptr node) const noexcept -> slab_ref*
+  {
+    for (slab_ref* ref = m_slabs; ref != nullptr; ref = ref->m_next) {
+      if (ref->m_slab->m_live.load(std::memory_order_acquire) != 0 && holds(*ref->m_slab, node)) { return ref; }
+    }
+    return nullptr;
+  }
+
+  /* destroy_nodes() for a list holding slabs, each slab's live count drops once */
+  auto destroy_slabbed() noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    slab_ref*      hit = nullptr; // consecutive nodes mostly share a slab
+    while ( m_head != nullptr ) {
+      node_ptr node = std::exchange(m_head, m_head->m_next);
+      node_traits::destroy(alloc, node);
+      if (hit == nullptr || !holds(*hit->m_slab, node)) { hit = slab_of(node); }
+      if (hit != nullptr)    { ++hit->m_freed; continue; }
+      if (!recycle(node))    { node_traits::deallocate(alloc, node, 1); }
+    }
+    for (slab_ref* ref = m_slabs; ref != nullptr; ref = ref->m_next) {
+      slab& s = *ref->m_slab;
+      if (ref->m_freed != 0 && s.m_live.fetch_sub(ref->m_freed, std::memory_order_acq_rel) == ref->m_freed) {
+        node_traits::deallocate(alloc, s.m_base, s.m_count);
+      }
+      ref->m_freed = 0;
+    }
+  }
+
+  /* takes over the refs of `other` along with all of its nodes, a slab is referred to once */
+  auto adopt_slabs(List_& other) noexcept -> void
+  {
+    while (other.m_slabs != nullptr) {
+      slab_ref* ref  = std::exchange(other.m_slabs, other.m_slabs->m_next);
+      bool      held = false;
+      for (slab_ref* mine = m_slabs; mine != nullptr && !held; mine = mine->m_next) { held = mine->m_slab == ref->m_slab; }
+      if (held) { drop_slab_ref(ref); }
+      else      { ref->m_next = m_slabs; m_slabs = ref; }
+    }
+  }
+
+  /* gives the empty list `other`, about to receive some of this list's nodes, a ref to each slab */
+  auto share_slabs(List_& other) -> void
+  {
+    ref_allocator refs(m_alloc);
+    for (slab_ref* mine = m_slabs; mine != nullptr; mine = mine->m_next) {
+      if (mine->m_slab->m_live.load(std::memory_order_acquire) == 0) { continue; }
+      slab_ref* ref = ref_traits::allocate(refs, 1);
+      ref_traits::construct(refs, ref, mine->m_slab, other.m_slabs, std::size_t{0});
+      mine->m_slab->m_owners.fetch_add(1, std::memory_order_relaxed);
+      other.m_slabs = ref;
+    }
+  }
+
+  /*
+  * `count` > 0 nodes constructed from the elements `first` walks over, all taken from one
+  * slab and linked in address order, so a traversal reads memory sequentially.
+  * returns {head, tail}, a single node is allocated on its own
+  */
+  template <typename It>
+  constexpr auto build_slab(It first, const std::size_t count) -> std::pair<node_ptr, node_ptr>
+  {
+    if (count == 1) {
+      node_ptr node = allocate_node(*first);
+      return {node, node};
+    }
+    node_allocator alloc(m_alloc);
+    slab_allocator records(m_alloc);
+    ref_allocator  refs(m_alloc);
+    node_ptr    base   = node_traits::allocate(alloc, count);
+    std::size_t built  = 0;
+    slab*       record = nullptr;
+    slab_ref*   ref    = nullptr;
+    try {
+      for (; built < count; ++built, ++first) {
+        node_traits::construct(alloc, base + built, std::in_place, *first);
+        if (built != 0) { base[built - 1].m_next = base + built; }
+      }
+      record = slab_traits::allocate(records, 1);
+      ref    = ref_traits::allocate(refs, 1);
+    } catch (...) {
+      if (record != nullptr) { slab_traits::deallocate(records, record, 1); }
+      for (std::size_t i = 0; i < built; ++i) { node_traits::destroy(alloc, base + i); }
+      node_traits::deallocate(alloc, base, count);
+      throw;
+    }
+    slab_traits::construct(records, record, base, count, count, std::size_t{1});
+    ref_traits::construct(refs, ref, record, m_slabs, std::size_t{0});
+    m_slabs = ref;
+    return {base, base + (count - 1)};
+  }
+
+  /* parallel_sort never gives a thread fewer nodes than this */
+  static constexpr std::size_t parallel_sort_grain = 1 << 14;
+
+  /*
+  * runs task(0) .. task(count - 1) on up to `count` threads, task(0) on the calling one.
+  * tasks whose thread can not be started run on the calling thread afterwards. waits for
+  * all of them, then rethrows the first exception one of them threw
+  */
+  template <typename Task>
+  static auto run_concurrently(const std::size_t count, Task task) -> void
+  {
+    std::vector<std::exception_ptr> errors(count);
+    const auto guarded = [&task, &errors](const std::size_t i) noexcept {
+      try { task(i); }
+      catch (...) { errors[i] = std::current_exception(); }
+    };
+    {
+      std::vector<std::jthread> workers;
+      std::size_t started = 1;
+      try {
+        workers.reserve(count - 1);
+        for (; started < count; ++started) { workers.emplace_back(guarded, started); }
+      } catch (...) {} // out of threads or memory: the rest runs below
+      guarded(0);
+      for (std::size_t i = started; i < count; ++i) { guarded(i); }
+    }
+    for (const auto& e : errors) {
+      if (e) { std::rethrow_exception(e); }
+    }
+  }
+
+  /* ( position, node ) every m_stride nodes, see use_checkpoints() */
+  using checkpoint           = std::pair<std::size_t, node_ptr>;
+  using checkpoint_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<checkpoint>;
 
-  sh_ptr      m_head = {nullptr};
-  sh_ptr      m_tail = {nullptr};
+  node_ptr    m_head = {nullptr};
+  node_ptr    m_tail = {nullptr};
   std::size_t m_size = {};
+  node_ptr    m_cursor     = {nullptr}; // last node reached by position, null when unknown
+  std::size_t m_cursor_pos = {};
+  [[no_unique_address]] Alloc m_alloc = {};
+  std::vector<checkpoint, checkpoint_allocator> m_checkpoints {checkpoint_allocator(m_alloc)}; // empty: stale
+  std::size_t m_stride       = {};      // positions between checkpoints at the last rebuild
+  std::size_t m_built_size   = {};      // size at the last rebuild
+  bool        m_checkpointed = {false}; // use_checkpoints() was called
+  slab_ref*   m_slabs        = {nullptr}; // slabs the nodes may come from, see build_slab()
+  node_ptr    m_spares       = {nullptr}; // freed nodes kept for reuse, see recycle_nodes()
+  std::size_t m_spare_count  = {};
+  std::size_t m_max_spares   = {};
 
 protected:
   T _failed_ = {};
 
 private:
 
-  class iterator {
+  /* forward iterator walking raw node pointers, `Const` selects const_iterator */
+  template <bool Const>
+  class basic_iterator {
   private:
-    sh_ptr node_ptr {nullptr};
+    node_ptr node_ptr_ {nullptr};
+    //
+    friend class List_;
+    template <bool> friend class basic_iterator;
     //
   public:
-    iterator(const sh_ptr& newPtr)  : node_ptr(newPtr) {}
-    iterator(std::nullptr_t newPtr) : node_ptr(newPtr) {}
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    constexpr basic_iterator(node_ptr newPtr)       noexcept : node_ptr_(newPtr) {}
+    constexpr basic_iterator(std::nullptr_t newPtr) noexcept : node_ptr_(newPtr) {}
+    // iterator -> const_iterator
+    template <bool C = Const> requires C
+    constexpr basic_iterator(const basic_iterator<false>& itr) noexcept : node_ptr_(itr.node_ptr_) {}
     //
-    bool operator!=(const iterator& itr) const {
-      return node_ptr != itr.node_ptr;
+    constexpr bool operator==(const basic_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const basic_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
     }
     //
-    T& operator*() const {
-      return node_ptr->m_data;
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
     }
     // pre increment
-    iterator operator++() {
-      node_ptr = node_ptr->m_next;
+    constexpr basic_iterator& operator++() noexcept {
+      node_ptr_ = node_ptr_->m_next;
       return *this;
     }
     // post increment
-    iterator operator++(int) {
-      node_ptr = node_ptr->m_next;
-      return *this;
+    constexpr basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      node_ptr_ = node_ptr_->m_next;
+      return old;
     }
-  }; // end of class iterator
+  }; // end of class basic_iterator
 
-public:
+  /* frees every node, leaves the list empty */
+  constexpr auto destroy_nodes() noexcept -> void
+  {
+    if (m_slabs != nullptr) { destroy_slabbed(); }
+    while ( m_head != nullptr ) {
+      node_ptr next = m_head->m_next;
+      free_node(m_head);
+      m_head = next;
+    }
+    m_tail = nullptr;
+    m_size = {};
+    drop_slab_refs(); // spares never come from a slab
+    forget_positions();
+  }
 
-  [[nodiscard]] constexpr auto begin()  const noexcept -> iterator { return iterator(m_head); }
-  [[nodiscard]] constexpr auto end()    const noexcept -> iterator { return iterator(nullptr); }
+  /* nodes moved to other positions: the cursor and the checkpoints are rebuilt on demand */
+  constexpr auto forget_positions() noexcept -> void
+  {
+    m_cursor = nullptr;
+    m_checkpoints.clear();
+  }
 
-  /* constructors */
-  List_() noexcept = default;
-  //
-  explicit constexpr List_(List_<T> && lh) noexcept
-    : m_head(nullptr), m_tail(nullptr), m_size(0) {
+  /* forgets the chain without freeing it, another list owns the nodes ( and adopted the slabs ) now */
+  constexpr auto release() noexcept -> void
+  {
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_size = {};
+    forget_positions();
+  }
+
+  /* one pass recording every m_stride-th node, m_stride is about sqrt(size()) */
+  constexpr auto build_checkpoints() -> void
+  {
+    m_checkpoints.clear();
+    m_stride     = std::size_t{1} << std::max(static_cast<int>(std::bit_width(m_size)) / 2, 4);
+    m_built_size = m_size;
+    m_checkpoints.reserve(m_size / m_stride + 1);
+    std::size_t pos = 0;
+    for (node_ptr it = m_head; it != nullptr; it = it->m_next, ++pos) {
+      if ((pos & (m_stride - 1)) == 0) { m_checkpoints.emplace_back(pos, it); }
+    }
+  }
+
+  /* first checkpoint after `pos` */
+  constexpr auto checkpoint_after(const std::size_t pos) noexcept
+  {
+    return std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), pos,
+                            [](const std::size_t p, const checkpoint& c) { return p < c.first; });
+  }
+
+  /*
+  * last checkpoint at or before `pos`. the index is rebuilt when stale, when the list
+  * doubled or halved since, or when edits piled up so many nodes after one checkpoint
+  * that the walk from it would be longer than 4 strides
+  */
+  constexpr auto nearest_checkpoint(const std::size_t pos) -> checkpoint
+  {
+    if (m_checkpoints.empty() || m_size > 2 * m_built_size || 2 * m_size < m_built_size) { build_checkpoints(); }
+    checkpoint found = *std::prev(checkpoint_after(pos));
+    if (pos - found.first > 4 * m_stride) {
+      build_checkpoints();
+      found = *std::prev(checkpoint_after(pos));
+    }
+    return found;
+  }
+
+  /*
+  * the head was pushed or popped: every other checkpoint moves with its node. the front
+  * entry is always the only one at 0 and holds m_head, on a pop the old head's entry goes
+  * and a checkpoint that reached 0 takes its place ( the insert reuses the erased room )
+  */
+  constexpr auto checkpoint_head_changed(const bool pushed) noexcept -> void
+  {
+    if (m_checkpoints.empty()) { return; }
+    if (pushed) {
+      for (auto& [pos, node] : m_checkpoints) { if (pos != 0) { ++pos; } }
+      m_checkpoints.front().second = m_head;
+      return;
+    }
+    m_checkpoints.erase(m_checkpoints.begin());
+    for (auto& [pos, node] : m_checkpoints) { --pos; }
+    if (m_checkpoints.empty() || m_checkpoints.front().first != 0) { m_checkpoints.insert(m_checkpoints.begin(), {0, m_head}); }
+  }
+
+  /* a node was linked in at `pos`: checkpoints from there on moved up by one */
+  constexpr auto checkpoint_inserted(const std::size_t pos) noexcept -> void
+  {
+    for (auto it = checkpoint_after(pos - 1); it != m_checkpoints.end(); ++it) { ++it->first; }
+  }
+
+  /* `victim` was unlinked from `pos`, `prev` held `pos` - 1 */
+  constexpr auto checkpoint_erased(const std::size_t pos, const node_ptr victim, const node_ptr prev) noexcept -> void
+  {
+    auto it = checkpoint_after(pos - 1);
+    if (it != m_checkpoints.end() && it->second == victim) {
+      // `prev` takes over, unless it is a checkpoint already
+      if (std::prev(it)->first == pos - 1) { it = m_checkpoints.erase(it); }
+      else                                  { *it++ = {pos - 1, prev}; }
+    }
+    for (; it != m_checkpoints.end(); ++it) { --it->first; }
+  }
+
+  /*
+  * node at `pos` < size(). starts from the nearest checkpoint when they are on, or from
+  * the cursor when that is closer, and leaves the cursor on the result, so ascending
+  * positional access walks each node once.
+  * anything that moves nodes to other positions must call forget_positions()
+  */
+  constexpr auto node_at(const std::size_t pos) -> node_ptr
+  {
+    if (pos == m_size - 1) { return m_tail; }
+    node_ptr    it = m_head;
+    std::size_t i  = 0;
+    if (m_checkpointed) { std::tie(i, it) = nearest_checkpoint(pos); }
+    if (m_cursor != nullptr && i <= m_cursor_pos && m_cursor_pos <= pos) { it = m_cursor; i = m_cursor_pos; }
+    for (; i < pos; ++i) { it = it->m_next; }
+    m_cursor     = it;
+    m_cursor_pos = pos;
+    return it;
+  }
+
+  /* nodes may only change lists when both free them through equal allocators */
+  [[nodiscard]] constexpr auto can_adopt(const List_& other) const noexcept -> bool
+  {
+    if constexpr (std::allocator_traits<Alloc>::is_always_equal::value) { return true; }
+    else { return m_alloc == other.m_alloc; }
+  }
+
+  /* takes over `lh`'s chain, `lh` is left empty */
+  constexpr auto steal(List_& lh) noexcept -> void
+  {
     m_head = lh.m_head;
     m_tail = lh.m_tail;
     m_size = lh.m_size;
+    adopt_slabs(lh);
+    forget_positions();
     //
-    lh.m_tail.reset();
-    lh.m_head.reset();
-    lh.m_size = {};
+    lh.release();
   }
+
+  /* cuts `chain` after `count` nodes, returns what follows */
+  static constexpr auto cut(node_ptr chain, std::size_t count) noexcept -> node_ptr
+  {
+    for (; chain != nullptr && count > 1; --count) { chain = chain->m_next; }
+    if (chain == nullptr) { return nullptr; }
+    node_ptr rest = chain->m_next;
+    chain->m_next = nullptr;
+    return rest;
+  }
+
+  /* last node of a non-empty null-terminated chain */
+  static constexpr auto last_of(node_ptr chain) noexcept -> node_ptr
+  {
+    while (chain->m_next != nullptr) { chain = chain->m_next; }
+    return chain;
+  }
+
+  /**
+  * @brief merges two sorted null-terminated chains, ties are taken from `left` first.
+  *        when `comp` or `proj` throws, every node of both chains is relinked into one
+  *        chain stored in `left`, in no particular order, and `right` is set to null
+  * @complexity O(n + m)
+  * @param left_tail, right_tail : last nodes when known, spares walking the leftover run
+  * @return {head, tail} of the merged chain
+  */
+  template <typename Compare, typename Proj>
+  static constexpr auto merge_chains(node_ptr& left, node_ptr& right, Compare& comp, Proj& proj,
+                                     node_ptr left_tail = nullptr, node_ptr right_tail = nullptr)
+      -> std::pair<node_ptr, node_ptr>
+  {
+    node_ptr  l    = left;
+    node_ptr  r    = right;
+    node_ptr  head = nullptr;
+    node_ptr  tail = nullptr;
+    node_ptr* link = &head;
+    try {
+      while (l != nullptr && r != nullptr) {
+        if (std::invoke(comp, std::invoke(proj, r->m_data), std::invoke(proj, l->m_data))) {
+          tail = r; r = r->m_next;
+        } else {
+          tail = l; l = l->m_next;
+        }
+        *link = tail;
+        link  = &tail->m_next;
+      }
+    } catch (...) {
+      // the merged prefix, then what is left of `left`, then what is left of `right`
+      *link = (l != nullptr) ? l : r;
+      if (l != nullptr && r != nullptr) { last_of(l)->m_next = r; }
+      left  = head;
+      right = nullptr;
+      throw;
+    }
+    *link = (l != nullptr) ? l : r;
+    if (l != nullptr && left_tail  != nullptr) { return {head, left_tail}; }
+    if (r != nullptr && right_tail != nullptr) { return {head, right_tail}; }
+    if (tail == nullptr) { tail = head; } // one side was empty
+    while (tail != nullptr && tail->m_next != nullptr) { tail = tail->m_next; } // walk the leftover run
+    return {head, tail};
+  }
+
+  /**
+  * @brief bottom-up merge sort of a chain of `count` nodes, runs double every pass.
+  *        when `comp` or `proj` throws, `head` still holds every node, in no particular order
+  * @complexity O(n log(n))
+  * @return the new tail, `head` is updated in place
+  */
+  template <typename Compare, typename Proj>
+  static constexpr auto sort_chain(node_ptr& head, const std::size_t count, Compare& comp, Proj& proj)
+      -> node_ptr
+  {
+    node_ptr tail = head;
+    for (std::size_t width = 1; width < count; width *= 2) {
+      node_ptr  rest = head;
+      node_ptr* link = &head;
+      while (rest != nullptr) {
+        node_ptr left  = rest;
+        node_ptr right = cut(left, width);
+        rest           = cut(right, width);
+        node_ptr first = nullptr;
+        node_ptr last  = nullptr;
+        try { std::tie(first, last) = merge_chains(left, right, comp, proj); }
+        catch (...) {
+          *link = left;
+          last_of(left)->m_next = rest;
+          throw;
+        }
+        *link = first;
+        link  = &last->m_next;
+        tail  = last;
+      }
+    }
+    return tail;
+  }
+
+public:
+
+  using iterator        = basic_iterator<false>;
+  using const_iterator  = basic_iterator<true>;
+
+  [[nodiscard]] constexpr auto begin()        noexcept -> iterator       { return iterator(m_head); }
+  [[nodiscard]] constexpr auto end()          noexcept -> iterator       { return iterator(nullptr); }
+  [[nodiscard]] constexpr auto begin()  const noexcept -> const_iterator { return const_iterator(m_head); }
+  [[nodiscard]] constexpr auto end()    const noexcept -> const_iterator { return const_iterator(nullptr); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return const_iterator(m_head); }
+  [[nodiscard]] constexpr auto cend()   const noexcept -> const_iterator { return const_iterator(nullptr); }
+
+  /* constructors */
+  List_() noexcept = default;
   //
-  explicit constexpr List_(const List_<T>& lh) noexcept {
-    m_head = lh.m_head;
-    m_tail = lh.m_tail;
-    m_size = lh.m_size;
+  explicit constexpr List_(const Alloc& alloc) noexcept
+    : m_alloc(alloc) {}
+  //
+  constexpr List_(List_ && lh) noexcept
+    : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(lh.m_alloc), m_checkpointed(lh.m_checkpointed),
+      m_max_spares(lh.m_max_spares) {
+    steal(lh);
+  }
+  //
+  constexpr List_(const List_& lh)
+    : m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(lh.m_alloc)),
+      m_checkpointed(lh.m_checkpointed), m_max_spares(lh.m_max_spares) {
+    for (const auto& i : lh) { push_back(i); }
   }
 
   //
   template<typename ...args>
+    requires (sizeof...(args) > 0 && (std::is_convertible_v<const args&, T> && ...))
   explicit constexpr List_(const args& ...arg) {
-    (push_back(arg),...);
+    (emplace_back(arg),...);
   }
 
   //
   template<typename ...args>
+    requires (sizeof...(args) > 0 && (std::is_convertible_v<args&&, T> && ...))
   explicit constexpr List_(args&& ...arg) {
-    (push_back(arg),...);
+    (emplace_back(std::forward<args>(arg)),...);
   }
 
-  //
-  explicit constexpr List_(std::initializer_list<T> &&arg) {
-    for (auto &&i : arg) { push_back(i); }
+  // the nodes come from one slab, see append_range() for when its memory is released
+  explicit constexpr List_(std::initializer_list<T> &&arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    append_range(arg);
   }
 
-  //
-  explicit constexpr List_(const std::initializer_list<T> &arg) {
-    for (const auto &i : arg) { push_back(i); }
+  // the nodes come from one slab, see append_range() for when its memory is released
+  explicit constexpr List_(const std::initializer_list<T> &arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    append_range(arg);
   }
 
   //
-  constexpr List_<T>& operator=(const List_<T>& lh) noexcept {
+  constexpr List_& operator=(const List_& lh) {
     if (this != &lh) {
-      m_head = lh.m_head;
-      m_tail = lh.m_tail;
-      m_size = lh.m_size;
+      destroy_nodes();
+      if constexpr (std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value) {
+        free_spares();
+        m_alloc = lh.m_alloc;
+      }
+      for (const auto& i : lh) { push_back(i); }
     }
     return *this;
   }
 
   //
-  constexpr List_<T>& operator=(List_<T>&& lh) noexcept {
+  constexpr List_& operator=(List_&& lh) noexcept(
+      std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value
+   || std::allocator_traits<Alloc>::is_always_equal::value) {
     if (this != &lh) {
-      m_head = lh.m_head;
-      m_tail = lh.m_tail;
-      m_size = lh.m_size;
-      //
-      lh.m_tail = {nullptr};
-      lh.m_head = {nullptr};
-      lh.m_size = {};
+      destroy_nodes();
+      if constexpr (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value) {
+        free_spares();
+        m_alloc = lh.m_alloc;
+        steal(lh);
+      } else {
+        // nodes can only change hands when both lists free through equal allocators
+        if (m_alloc == lh.m_alloc) { steal(lh); }
+        else {
+          for (auto& i : lh) { push_back(std::move(i)); }
+          lh.destroy_nodes();
+        }
+      }
     }
     return *this;
   }
 
   /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
   /**
   * @brief check if list is empty
   * @complexity O(1)
@@ -150,7 +729,7 @@ public:
   */
   [[nodiscard]] constexpr inline auto is_empty() const noexcept -> bool
   {
-    return m_head == nullptr ? true : false;
+    return m_head == nullptr;
   }
 
   /**
@@ -160,6 +739,33 @@ public:
   */
   [[nodiscard]] constexpr inline auto size() const noexcept -> std::size_t { return m_size; }
 
+  /**
+  * @brief keeps a ( position, node ) pair every ~sqrt(n) nodes, so at(), push_at() and
+  *        pop_at() at random positions walk from the nearest one instead of from the head.
+  *        push_at / pop_at / push_front / pop_front adjust the pairs in O(sqrt(n)),
+  *        other relinking drops them and the next positional call rebuilds them in O(n)
+  * @complexity O(1), the index is built by the next positional call
+  * @param on : false drops the index and frees its memory
+  */
+  constexpr auto use_checkpoints(const bool on = true) -> void
+  {
+    m_checkpointed = on;
+    if (!on) { m_checkpoints.clear(); m_checkpoints.shrink_to_fit(); }
+  }
+
+  /**
+  * @brief keeps up to `max_spares` freed nodes for the next insertions to reuse, so a list
+  *        churning through pop_front() / push_back() at a steady size stops calling the
+  *        allocator. clear() fills the spares too, nodes from append_range() slabs are never kept
+  * @complexity O(1), O(spares) when lowering the bound
+  * @param max_spares : 0 deallocates the spares kept so far
+  */
+  auto recycle_nodes(const std::size_t max_spares = 64) -> void
+  {
+    m_max_spares = max_spares;
+    free_spares(max_spares);
+  }
+
   /**
   * @brief returns first element
   * @complexity O(1)
@@ -190,7 +796,8 @@ public:
 
   /**
   * @brief return element at given position&
-  * @complexity O(n)
+  * @complexity O(n), amortized O(1) per step when positions are visited in ascending order,
+  *             O(sqrt(n)) expected with use_checkpoints()
   * @param times
   * @return auto&
   */
@@ -198,89 +805,178 @@ public:
   {
     if (is_empty()) [[unlikely]]      { empty_list(); return _failed_;}
     if (times < 0 || times >= size()) { empty_list(); return _failed_;}
-    auto it = begin();
-    for (std::size_t i = 0; i < times; ++i) { ++it; }
-    return (*it);
+    return node_at(times)->m_data;
   }
 
-  [[nodiscard]] constexpr inline auto at(const sh_ptr& ptr) const -> auto &
+  [[nodiscard]] constexpr inline auto at(const node_ptr ptr) const -> auto &
   {
     return ptr->m_data;
   }
 
   /**
-  * @brief add element at end of list
+  * @brief constructs an element at end of list from `arg`, in place inside the node
   * @complexity O(1)
-  * @param arg
+  * @param arg : forwarded to T's constructor
+  * @return T& the new element
   */
-  constexpr auto push_back(T &&arg) -> void
+  template <typename ...Args>
+  constexpr auto emplace_back(Args&& ...arg) -> T &
   {
-    sh_ptr new_node   = allocate_node();
-    new_node->m_data  = arg;
-    new_node->m_next  = nullptr;
+    node_ptr new_node = allocate_node(std::forward<Args>(arg)...);
     //
     if (is_empty()) [[unlikely]] {
       m_head = new_node; // |0, null|
-      m_tail = new_node; // |0, null|
     }
-    m_tail->m_next = new_node; // changes head-> next too, then it changes
-    // the previous temps next
+    else { m_tail->m_next = new_node; } // old tail's next points at new node
     // head ->|0, 0x1| -> |1, 0x2| -> |2, null|
     m_tail = new_node; // now tail points to temp
     //
     ++m_size;
+    return new_node->m_data;
   }
 
   /**
-  * @brief add element at end of list
+  * @brief constructs an element at the beginning of list, in place inside the node
   * @complexity O(1)
-  * @param arg
+  * @param arg : forwarded to T's constructor
+  * @return T& the new element
   */
-  constexpr auto push_back(const T &arg) -> void
+  template <typename ...Args>
+  constexpr auto emplace_front(Args&& ...arg) -> T &
   {
-    sh_ptr new_node   = allocate_node();
-    new_node->m_data  = arg;
-    new_node->m_next  = nullptr;
+    node_ptr new_node = allocate_node(std::forward<Args>(arg)...);
+    new_node->m_next  = m_head;
+    // now temp-> next points to what old head was pointing at
+    m_head = new_node; // new head points to new node (old head)
+    if ( m_tail == nullptr ) { m_tail = m_head; }
+    m_cursor = nullptr; // every position moved up by one
+    checkpoint_head_changed(true);
     //
-    if (is_empty()) {
-      m_head = new_node; // |0, null|
-      m_tail = new_node; // |0, null|
+    ++m_size;
+    return new_node->m_data;
+  }
+
+  /**
+  * @brief constructs an element at given position, in place inside the node
+  * @complexity O(n), amortized O(1) when positions ascend from one call to the next,
+  *             O(sqrt(n)) amortized with use_checkpoints()
+  * @param pos
+  * @param arg : forwarded to T's constructor
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  constexpr auto emplace_at(const std::size_t pos, Args&& ...arg) -> T &
+  {
+    if (pos > size())             { empty_list(); return _failed_; }
+    if (pos == 0)                 { return emplace_front(std::forward<Args>(arg)...); }
+    if (pos == size())            { return emplace_back(std::forward<Args>(arg)...); }
+    /* adding nodes between previous and next, positions up to the cursor stay put */
+    node_ptr prev_node = node_at(pos - 1); // hold previous node
+    node_ptr new_node  = allocate_node(std::forward<Args>(arg)...); // hold new node
+    new_node->m_next   = prev_node->m_next;
+    prev_node->m_next  = new_node;
+    checkpoint_inserted(pos);
+    //
+    ++m_size;
+    return new_node->m_data;
+  }
+
+  /**
+  * @brief constructs an element right after `pos`, in place inside the node
+  * @complexity O(1)
+  * @param pos : an element of this list, end() appends
+  * @param arg : forwarded to T's constructor
+  * @return iterator to the new element
+  */
+  template <typename ...Args>
+  constexpr auto emplace_after(const const_iterator pos, Args&& ...arg) -> iterator
+  {
+    if (pos.node_ptr_ == nullptr || pos.node_ptr_ == m_tail) {
+      emplace_back(std::forward<Args>(arg)...);
+      return iterator(m_tail);
     }
-    m_tail->m_next = new_node; // changes head-> next too, then it changes
-    // the previous temps next
-    // head ->|0, 0x1| -> |1, 0x2| -> |2, null|
-    m_tail = new_node; // now tail points to temp
+    node_ptr new_node     = allocate_node(std::forward<Args>(arg)...);
+    new_node->m_next      = pos.node_ptr_->m_next;
+    pos.node_ptr_->m_next = new_node;
+    forget_positions();
     //
     ++m_size;
+    return iterator(new_node);
   }
 
-  //
-  template<typename ...args>
-  inline constexpr auto push_back(const args&...arg) -> void
+  /**
+  * @brief copies the elements of `range` to the end of list. when the length is known up
+  *        front ( sized or forward ranges ) all nodes come from one allocation, a slab, and
+  *        are linked in address order, otherwise they are emplaced one at a time.
+  *        a slab is only deallocated once every one of its nodes was freed, in whichever
+  *        list it ended up, so popping most of a bulk loaded list keeps all of its memory.
+  *        freeing a node of a list holding slabs checks it against each of them ( one
+  *        atomic decrement for a slab node ), lists without slabs free as before
+  * @complexity O(k), one allocation for k elements plus two small ones for the slab's record
+  * @param range : its elements are forwarded to T's constructor
+  */
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  constexpr auto append_range(R&& range) -> void
+  {
+    if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+      const auto count = static_cast<std::size_t>(std::ranges::distance(range));
+      if (count == 0) { return; }
+      auto [head, tail] = build_slab(std::ranges::begin(range), count);
+      if (is_empty()) { m_head = head; }
+      else            { m_tail->m_next = head; }
+      m_tail  = tail;
+      m_size += count;
+    } else {
+      for (auto&& i : range) { emplace_back(std::forward<decltype(i)>(i)); }
+    }
+  }
+
+  /**
+  * @brief replaces the elements with copies of [first, last), see append_range()
+  * @complexity O(n + k)
+  * @param first, last : must not point into this list
+  */
+  template <std::input_iterator It, std::sentinel_for<It> Sentinel>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+  constexpr auto assign(It first, Sentinel last) -> void
   {
-    (push_back(arg),...);
+    destroy_nodes();
+    append_range(std::ranges::subrange(std::move(first), std::move(last)));
   }
 
-  /** @fixme: causes seg fault*/
-  /*inline constexpr auto push_back(auto &&...arg) -> void
+  /**
+  * @brief copies the elements of `range` in front of position `pos`, see append_range()
+  * @complexity O(pos + k), one allocation for k elements
+  * @param pos : size() appends
+  * @param range
+  */
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  auto insert_range_at(const std::size_t pos, R&& range) -> void
   {
-    (push_back(arg),...);
-  }*/
+    if (pos > size())  { empty_list(); return; }
+    if (pos == size()) { append_range(std::forward<R>(range)); return; }
+    List_ chunk(m_alloc);
+    chunk.append_range(std::forward<R>(range));
+    if (pos == 0) { prepend(std::move(chunk)); }
+    else          { splice_after(const_iterator(node_at(pos - 1)), std::move(chunk)); }
+  }
 
   /**
-  * @brief add element at the beginning of list
+  * @brief add element at end of list
   * @complexity O(1)
   * @param arg
   */
-  inline constexpr auto push_front(const T &arg) -> void
+  constexpr auto push_back(const T &arg) -> void { emplace_back(arg); }
+  constexpr auto push_back(T &&arg)      -> void { emplace_back(std::move(arg)); }
+
+  // one push_back per argument, in order
+  template<typename ...args>
+    requires (sizeof...(args) > 1 && (std::is_constructible_v<T, args&&> && ...))
+  inline constexpr auto push_back(args&& ...arg) -> void
   {
-    sh_ptr new_node   = allocate_node();
-    new_node->m_data  = arg;
-    new_node->m_next  = m_head;
-    // now temp-> next points to what old head was pointing at
-    m_head = new_node; // new head points to new node (old head)
-    //
-    ++m_size;
+    (emplace_back(std::forward<args>(arg)), ...);
   }
 
   /**
@@ -288,69 +984,26 @@ public:
   * @complexity O(1)
   * @param arg
   */
-  inline constexpr auto push_front(T &&arg) -> void
-  {
-    sh_ptr new_node   = allocate_node();
-    new_node->m_data  = arg;
-    new_node->m_next  = m_head;
-    // now temp-> next points to what old head was pointing at
-    m_head = new_node; // new head points to new node (old head)
-    //
-    ++m_size;
-  }
+  inline constexpr auto push_front(const T &arg) -> void { emplace_front(arg); }
+  inline constexpr auto push_front(T &&arg)      -> void { emplace_front(std::move(arg)); }
 
-  //
-  inline constexpr auto push_front(const auto& ...arg) -> void {
-    (push_front(arg), ...);
+  // one push_front per argument, in order, so the last one ends up first
+  template<typename ...args>
+    requires (sizeof...(args) > 1 && (std::is_constructible_v<T, args&&> && ...))
+  inline constexpr auto push_front(args&& ...arg) -> void
+  {
+    (emplace_front(std::forward<args>(arg)), ...);
   }
 
   /**
   * @brief add element at given position
-  * @complexity O(n)
+  * @complexity O(n), amortized O(1) when positions ascend from one call to the next,
+  *             O(sqrt(n)) amortized with use_checkpoints()
   * @param pos
   * @param arg
   */
-  constexpr auto push_at(const std::size_t pos, const T &arg) -> void
-  {
-    if (is_empty())  [[unlikely]]     { empty_list(); return; }
-    if (pos == 0)                     { push_front(arg); }
-    if (pos == size()-1)              { push_back(arg); }
-    /* adding nodes between previous and next */
-    sh_ptr prev_node  = allocate_node(); // hold previous node
-    sh_ptr new_node   = allocate_node(); // hold new node
-    sh_ptr next_node  = m_head; // points to next node
-    //
-    for (std::size_t i = 0; i < pos; ++i) {
-      prev_node = next_node;
-      next_node = next_node->m_next;
-    }
-    new_node->m_data  = arg;
-    prev_node->m_next = new_node;
-    new_node->m_next  = next_node;
-    //
-    ++m_size;
-  }
-
-  constexpr auto push_at(const std::size_t pos, T &&arg) -> void
-  {
-    if (is_empty()) [[unlikely]]  { empty_list(); return; }
-    if (pos == 0)                 { push_front(arg); }
-    if (pos == size()-1)          { push_back(arg); }
-    /* adding nodes between previous and next */
-    sh_ptr prev_node  = allocate_node(); // hold previous node
-    sh_ptr new_node   = allocate_node(); // hold new node
-    sh_ptr next_node  = m_head; // points to next node
-    //
-    for (std::size_t i = 0; i < pos; ++i) {
-      prev_node = next_node;
-      next_node = next_node->m_next;
-    }
-    new_node->m_data    = arg;
-    prev_node->m_next   = new_node;
-    new_node->m_next    = next_node;
-    //
-    ++m_size;
-  }
+  constexpr auto push_at(const std::size_t pos, const T &arg) -> void { emplace_at(pos, arg); }
+  constexpr auto push_at(const std::size_t pos, T &&arg)      -> void { emplace_at(pos, std::move(arg)); }
 
   /**
   * @brief adds value after specific location
@@ -363,43 +1016,42 @@ public:
       -> void
   {
     if (is_empty()) { empty_list(); return;}
-    if (after == at(m_tail)) { push_back(val); }
-    sh_ptr it = {m_head};
-    for(; it->m_next != nullptr && at(it) != after; it = it->m_next) {}
-    if (!it->m_next) { std::cerr << "- `pos` not found..."; return;}
+    node_ptr it = {m_head};
+    for(; it != nullptr && at(it) != after; it = it->m_next) {}
+    if (!it) { std::cerr << "- `pos` not found..."; return;}
+    if (it == m_tail) { push_back(val); return; }
     //
-    sh_ptr new_node = allocate_node();
-    new_node->m_data = val; // add data to new_node
+    node_ptr new_node = allocate_node(val); // add data to new_node
     new_node->m_next = it->m_next; // new_node's next now points at what it's next it
     it->m_next = new_node; // it's next points to new_node
+    forget_positions();
     //
     ++m_size;
   }
 
   //[[deprecated]]
   constexpr
-  auto push_after(T&& after, T&& val) 
+  auto push_after(T&& after, T&& val)
       -> void
   {
     if (is_empty()) [[unlikely]] { empty_list(); return;}
-    if (after == at(m_tail)) { push_back(val); }
-    if (after == at(m_head)) { push_front(val); }
-    sh_ptr it = {m_head};
-    for( ; at(it) != after; it = it->m_next ) {}
+    node_ptr it = {m_head};
+    for( ; it != nullptr && at(it) != after; it = it->m_next ) {}
     //
-    if (!it->m_next) { std::cerr << "- `pos` not found..."; return;}
+    if (!it) { std::cerr << "- `pos` not found..."; return;}
+    if (it == m_tail) { push_back(std::move(val)); return; }
     //
-    sh_ptr new_node = allocate_node();
-    new_node->m_data = val; // add data to new_node
+    node_ptr new_node = allocate_node(std::move(val)); // add data to new_node
     new_node->m_next = it->m_next; // new_node's next now points at what it's next it
     it->m_next = new_node; // it's next points to new_node
+    forget_positions();
     //
     ++m_size;
   }
 
   /**
    * @brief pushs element before a node
-   * 
+   *
    * @param before the node that you wanna push before
    * @param val the value
    */
@@ -408,18 +1060,19 @@ public:
       -> void
   {
     if (is_empty()) { empty_list(); return; }
+    if (before == at(m_head)) { push_front(val); return; }
     auto temp = m_head;
     auto temp_next = temp->m_next;
     //
-    while( at(temp_next) != before ) {
+    while( temp_next != nullptr && at(temp_next) != before ) {
       temp = temp->m_next; // before next node
       temp_next = temp->m_next; // the node that we are pushing before
     }
-    if ( !temp_next ) { std::cerr << "- pos not found...\n"; }
-    sh_ptr new_node = allocate_node();
+    if ( !temp_next ) { std::cerr << "- pos not found...\n"; return; }
+    node_ptr new_node = allocate_node(val); // add data to new_node
     temp->m_next = new_node; // before node pointing at new node
-    new_node->m_data = val;
     new_node->m_next = temp_next; // the node we added points at next node
+    forget_positions();
     //
     ++m_size;
   }
@@ -430,18 +1083,19 @@ public:
       -> void
   {
     if (is_empty()) { empty_list(); return; }
+    if (before == at(m_head)) { push_front(std::move(val)); return; }
     auto temp = m_head;
     auto temp_next = temp->m_next;
     //
-    while( at(temp_next) != before ) {
+    while( temp_next != nullptr && at(temp_next) != before ) {
       temp = temp->m_next; // before next node
       temp_next = temp->m_next; // the node that we are pushing before
     }
-    if ( !temp_next ) { std::cerr << "- pos not found...\n"; }
-    sh_ptr new_node = allocate_node();
+    if ( !temp_next ) { std::cerr << "- pos not found...\n"; return; }
+    node_ptr new_node = allocate_node(std::move(val)); // add data to new_node
     temp->m_next = new_node; // before node pointing at new node
-    new_node->m_data = val;
     new_node->m_next = temp_next; // the node we added points at next node
+    forget_positions();
     //
     ++m_size;
   }
@@ -452,17 +1106,19 @@ public:
   auto pop_back() -> void
   {
     if (is_empty()) [[unlikely]] { empty_list(); return; }
-    if (size() == 1)             { m_head.reset(); return; } // if one node created
+    if (size() == 1)             { destroy_nodes(); return; } // if one node created
     //
-    sh_ptr last   = {m_head};
-    while (last->m_next->m_next != nullptr) {
+    node_ptr last = {m_head};
+    while (last->m_next != m_tail) {
       last = last->m_next;
     }
+    if (m_cursor == m_tail) { m_cursor = nullptr; }
+    if (!m_checkpoints.empty() && m_checkpoints.back().second == m_tail) { m_checkpoints.pop_back(); }
+    free_node(m_tail);
     m_tail          = last; // tail points to 1 step before old tail
     m_tail->m_next  = nullptr;
     //
     --m_size;
-    last.reset();
   }
 
   /**
@@ -472,18 +1128,21 @@ public:
   auto pop_front() -> void
   {
     if (is_empty()) [[unlikely]]  { empty_list(); return; }
-    if (size() == 1)              { m_head.reset(); return; } // if one node created
+    if (size() == 1)              { destroy_nodes(); return; } // if one node created
     //
-    sh_ptr first  = {m_head}; // first points to old head
-    m_head        = m_head->m_next; // head points to one step ahead of old head
+    node_ptr first = {m_head}; // first points to old head
+    m_head         = m_head->m_next; // head points to one step ahead of old head
+    m_cursor       = nullptr;
+    checkpoint_head_changed(false);
     //
     --m_size;
-    first.reset();
+    free_node(first);
   }
 
   /**
   * @brief remove element at given position
-  * @complexity O(n)
+  * @complexity O(n), amortized O(1) when positions ascend from one call to the next,
+  *             O(sqrt(n)) amortized with use_checkpoints()
   */
   auto pop_at(const std::size_t pos) -> void
   {
@@ -493,32 +1152,27 @@ public:
     if (pos == 0)                 { pop_front(); return; }
     else if ( pos == s-1)         { pop_back(); return; }
     //
-    sh_ptr prev = allocate_node();
-    sh_ptr next = m_head;
     // ex: 0, 1, 2, 3, 4, 5 : pop_at(1) now:
-    sh_ptr it   = m_head;
-    for (std::size_t i = 0; i < pos && next != nullptr; ++i) {
-      prev  = it;                 // 0
-      next  = it->m_next->m_next; // 2
-      it    = it->m_next;         // 1
-    }
-    prev->m_next = next; // 0 -> 2 -> 3 -> 4 -> 5 and whatever was node 1, is now gone
+    node_ptr prev = node_at(pos - 1); // 0, the cursor stays valid
+    node_ptr it   = prev->m_next; // 1
+    prev->m_next  = it->m_next;   // 0 -> 2 -> 3 -> 4 -> 5 and whatever was node 1, is now gone
+    checkpoint_erased(pos, it, prev);
     --m_size;
     //
-    it = nullptr; // 1 -> nullptr
+    free_node(it);
   }
 
   /**
-  * @brief splitiing the current list into two lists
+  * @brief splitiing the current list into two lists, copying its elements
   * @complexity O(n)
   * @param l1
   * @param l2
   */
-  auto split(List_<T> &l1, List_<T> &l2) -> void
+  auto split(List_ &l1, List_ &l2) const & -> void
   {
     if (is_empty()) [[unlikely]] { empty_list(); return; }
     const auto& s   = size();
-    sh_ptr      it  = { m_head };
+    node_ptr    it  = { m_head };
     for (std::size_t i = 0; i < (s/2); ++i, it = it->m_next) {
       l1.push_back( at(it) );
     }
@@ -528,12 +1182,169 @@ public:
   }
 
   /**
-  * @brief merges two lists into one
+  * @brief splitting an expiring list: the first half of its nodes is appended
+  *        to l1 and the rest to l2 without copying, the list is left empty
+  * @complexity O(n/2)
+  * @param l1
+  * @param l2
+  */
+  auto split(List_ &l1, List_ &l2) && -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    List_ upper = split_at(size() / 2);
+    l1.append(std::move(*this));
+    l2.append(std::move(upper));
+  }
+
+  /**
+  * @brief detaches the nodes from `pos` to the end into a new list
+  * @complexity O(pos)
+  * @param pos : first position of the returned list, size() returns an empty list
+  * @return List_
+  */
+  [[nodiscard]] auto split_at(const std::size_t pos) -> List_
+  {
+    List_ rest(m_alloc);
+    if (pos > size()) { empty_list(); return rest; }
+    if (pos == 0)     { rest.steal(*this); return rest; }
+    share_slabs(rest);
+    node_ptr last = m_head;
+    for (std::size_t i = 1; i < pos; ++i) { last = last->m_next; }
+    //
+    rest.m_head  = last->m_next;
+    rest.m_tail  = rest.m_head ? m_tail : nullptr;
+    rest.m_size  = m_size - pos;
+    last->m_next = nullptr;
+    m_tail       = last;
+    m_size       = pos;
+    if (m_cursor_pos >= pos) { m_cursor = nullptr; }
+    while (!m_checkpoints.empty() && m_checkpoints.back().first >= pos) { m_checkpoints.pop_back(); }
+    return rest;
+  }
+
+  /**
+  * @brief detaches every node whose element satisfies `pred` into a new list,
+  *        both lists keep their relative order. when `pred` throws, this list keeps
+  *        every element: the ones not yet taken in order, followed by the taken ones
+  * @complexity O(n)
+  * @param pred
+  * @return List_
+  */
+  template <typename Pred>
+  [[nodiscard]] auto split_if(Pred pred) -> List_
+  {
+    List_     taken(m_alloc);
+    share_slabs(taken);
+    node_ptr  kept_tail  = nullptr;
+    node_ptr* kept_link  = &m_head;
+    node_ptr* taken_link = &taken.m_head;
+    node_ptr  it         = m_head;
+    try {
+      for (; it != nullptr; it = it->m_next) {
+        if (std::invoke(pred, std::as_const(it->m_data))) {
+          *taken_link  = it; taken_link = &it->m_next;
+          taken.m_tail = it;
+          ++taken.m_size;
+        } else {
+          *kept_link = it; kept_link = &it->m_next;
+          kept_tail  = it;
+        }
+      }
+    } catch (...) {
+      // `it` and what follows are still chained up to m_tail, the taken nodes go after them
+      *kept_link  = it;
+      *taken_link = nullptr;
+      if (taken.m_head != nullptr) {
+        m_tail->m_next = taken.m_head;
+        m_tail         = taken.m_tail;
+      }
+      taken.release();
+      forget_positions();
+      throw;
+    }
+    *kept_link  = nullptr;
+    *taken_link = nullptr;
+    m_tail      = kept_tail;
+    m_size     -= taken.m_size;
+    forget_positions();
+    return taken;
+  }
+
+  /**
+  * @brief links `other`'s nodes after the last element, `other` is left empty
+  * @complexity O(1), O(other.size()) when the allocators differ
+  * @param other
+  */
+  auto append(List_&& other) -> void
+  {
+    if (this == &other || other.is_empty()) { return; }
+    if (!can_adopt(other)) {
+      for (auto& i : other) { push_back(std::move(i)); }
+      other.destroy_nodes();
+      return;
+    }
+    if (is_empty()) { m_head = other.m_head; }
+    else            { m_tail->m_next = other.m_head; }
+    m_tail  = other.m_tail;
+    m_size += other.m_size;
+    adopt_slabs(other);
+    other.release();
+  }
+
+  /**
+  * @brief links `other`'s nodes before the first element, `other` is left empty
+  * @complexity O(1), O(other.size()) when the allocators differ
+  * @param other
+  */
+  auto prepend(List_&& other) -> void
+  {
+    if (this == &other || other.is_empty()) { return; }
+    if (!can_adopt(other)) {
+      List_ moved(m_alloc);
+      moved.append(std::move(other));
+      prepend(std::move(moved));
+      return;
+    }
+    other.m_tail->m_next = m_head;
+    if (is_empty()) { m_tail = other.m_tail; }
+    m_head  = other.m_head;
+    m_size += other.m_size;
+    adopt_slabs(other);
+    forget_positions();
+    other.release();
+  }
+
+  /**
+  * @brief links `other`'s nodes right after `pos`, `other` is left empty
+  * @complexity O(1), O(other.size()) when the allocators differ
+  * @param pos : an element of this list, end() appends
+  * @param other
+  */
+  auto splice_after(const const_iterator pos, List_&& other) -> void
+  {
+    if (this == &other || other.is_empty()) { return; }
+    if (pos.node_ptr_ == nullptr || pos.node_ptr_ == m_tail) { append(std::move(other)); return; }
+    if (!can_adopt(other)) {
+      List_ moved(m_alloc);
+      moved.append(std::move(other));
+      splice_after(pos, std::move(moved));
+      return;
+    }
+    other.m_tail->m_next  = pos.node_ptr_->m_next;
+    pos.node_ptr_->m_next = other.m_head;
+    m_size += other.m_size;
+    adopt_slabs(other);
+    forget_positions();
+    other.release();
+  }
+
+  /**
+  * @brief merges two lists into one, copying their elements
   * @complexity O(n)
   * @param l1
   * @param l2
   */
-  auto merge( List_<T>& l1,  List_<T>& l2) -> void
+  auto merge( List_& l1,  List_& l2) -> void
   {
     if (l1.is_empty()) [[unlikely]] { empty_list(); return; }
     if (l2.is_empty()) [[unlikely]] { empty_list(); return; }
@@ -541,44 +1352,220 @@ public:
     for ( const auto& i : l2 ) { push_back(i); }
   }
 
+  /**
+  * @brief merges two expiring lists into one by linking their nodes, both are left empty
+  * @complexity O(1)
+  * @param l1
+  * @param l2
+  */
+  auto merge( List_&& l1,  List_&& l2) -> void
+  {
+    if (l1.is_empty()) [[unlikely]] { empty_list(); return; }
+    if (l2.is_empty()) [[unlikely]] { empty_list(); return; }
+    append(std::move(l1));
+    append(std::move(l2));
+  }
+
   /**
   * @brief: sorts element in ASC order by default put `true` for DESC
-  * @conplexity  O(n^2)
+  * @complexity O(n log(n))
+  */
+  constexpr auto sort(bool desc = false) -> void
+  {
+    if ( !desc ) [[likely]] { sort(std::ranges::less{}); }
+    else                    { sort(std::ranges::greater{}); }
+  }
+
+  /**
+  * @brief stable bottom-up merge sort, relinks nodes instead of moving values
+  * @complexity O(n log(n)), O(1) extra space
+  * @param comp : strict weak order on projected values
+  * @param proj : applied to each element before comparing
   */
-  constexpr auto sort(bool desc = false) const -> void
+  template <typename Compare, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Compare, std::projected<const_iterator, Proj>>
+  constexpr auto sort(Compare comp, Proj proj = {}) -> void
   {
     if (is_empty()) { empty_list(); return; }
-    bool sorted   = true;
-    sh_ptr curr   = {};
-    sh_ptr next   = {};
+    forget_positions();
+    try { m_tail = sort_chain(m_head, m_size, comp, proj); }
+    catch (...) { m_tail = last_of(m_head); throw; }
+  }
+
+  /**
+  * @brief sorts on up to `threads` threads: the chain is cut into runs that are merge
+  *        sorted concurrently, then merged back pairwise (also concurrently) by relinking
+  * @complexity O(n log(n) / threads + n) with enough cores
+  * @param threads : worker count, lists shorter than `parallel_sort_grain` per run use fewer,
+  *                  runs whose thread can not be started are sorted on the calling thread
+  * @param comp : strict weak order on projected values, copied for every task. when it
+  *               throws, the list keeps every element in an unspecified order and the
+  *               first exception is rethrown
+  * @param proj : applied to each element before comparing
+  */
+  template <typename Compare = std::ranges::less, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Compare, std::projected<const_iterator, Proj>>
+  auto parallel_sort(const std::size_t threads = std::thread::hardware_concurrency(),
+                     Compare comp = {}, Proj proj = {}) -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    forget_positions();
+    const std::size_t runs = std::clamp<std::size_t>(m_size / parallel_sort_grain, 1, std::max<std::size_t>(threads, 1));
+    if (runs == 1) {
+      try { m_tail = sort_chain(m_head, m_size, comp, proj); }
+      catch (...) { m_tail = last_of(m_head); throw; }
+      return;
+    }
     //
-    if ( !desc ) [[likely]] {
-      while ( sorted ) {
-        sorted   = false;
-        curr     = {m_head};
-        while ( curr->m_next != nullptr ) {
-          next = curr->m_next;
-          if ( at(curr) > at(next) ) {
-            MYSWAP(at(next), at(curr));
-            sorted = true;
-          }
-          curr = curr->m_next;
-        }
+    std::vector<node_ptr>    heads(runs);
+    std::vector<node_ptr>    tails(runs);
+    std::vector<std::size_t> counts(runs);
+    node_ptr rest = m_head;
+    for (std::size_t i = 0; i < runs; ++i) {
+      counts[i] = m_size / runs + (i < m_size % runs ? 1 : 0);
+      heads[i]  = rest;
+      rest      = cut(rest, counts[i]);
+    }
+    // from here on every node is in exactly one of `heads`, whatever throws
+    try {
+      // every run is sorted on its own thread, each with its own copy of comp and proj
+      run_concurrently(runs, [&](const std::size_t i) {
+        Compare c = comp;
+        Proj    p = proj;
+        tails[i] = sort_chain(heads[i], counts[i], c, p);
+      });
+      // pairwise merge rounds: 0+1, 2+3, .. then 0+2, 4+6, .. until one run is left
+      for (std::size_t step = 1; step < runs; step *= 2) {
+        run_concurrently((runs - step - 1) / (2 * step) + 1, [&, step](const std::size_t k) {
+          const std::size_t i = k * 2 * step;
+          Compare c = comp;
+          Proj    p = proj;
+          std::tie(heads[i], tails[i]) = merge_chains(heads[i], heads[i + step], c, p, tails[i], tails[i + step]);
+          heads[i + step] = nullptr;
+        });
       }
-    } else {
-      while ( sorted ) {
-        sorted   = false;
-        curr     = {m_head};
-        while (curr->m_next != nullptr) {
-          next = curr->m_next;
-          if ( at(curr) < at(next) ) {
-            MYSWAP(at(curr), at(next));
-            sorted = true;
-          }
-          curr = curr->m_next;
+    } catch (...) {
+      // relink what is left of the runs in order, the list keeps every node
+      node_ptr* link = &m_head;
+      for (const node_ptr head : heads) {
+        if (head == nullptr) { continue; }
+        *link  = head;
+        m_tail = last_of(head);
+        link   = &m_tail->m_next;
+      }
+      throw;
+    }
+    m_head = heads[0];
+    m_tail = tails[0];
+  }
+
+  /**
+  * @brief merges another sorted list into this sorted list in one pass by
+  *        relinking, stable (ties keep this list's elements first), `other` is left empty.
+  *        when `comp` or `proj` throws, this list holds every element in an unspecified order
+  * @complexity O(n + m), no allocation unless the allocators differ
+  * @param other
+  * @param comp : the order both lists are sorted by
+  * @param proj : applied to each element before comparing
+  */
+  template <typename Compare = std::ranges::less, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Compare, std::projected<const_iterator, Proj>>
+  auto merge_sorted(List_&& other, Compare comp = {}, Proj proj = {}) -> void
+  {
+    if (this == &other || other.is_empty()) { return; }
+    if (!can_adopt(other)) {
+      List_ moved(m_alloc);
+      moved.append(std::move(other));
+      merge_sorted(std::move(moved), comp, proj);
+      return;
+    }
+    if (is_empty()) { steal(other); return; }
+    forget_positions();
+    m_size += other.m_size;
+    adopt_slabs(other);
+    try { std::tie(m_head, m_tail) = merge_chains(m_head, other.m_head, comp, proj, m_tail, other.m_tail); }
+    catch (...) { m_tail = last_of(m_head); other.release(); throw; } // m_head holds both chains
+    other.release();
+  }
+
+  /**
+  * @brief k-way merge of sorted lists through a binary heap of their heads,
+  *        stable (ties are taken from the earlier list), every input is left empty.
+  *        when `comp` or `proj` throws, the first list holds every element in an
+  *        unspecified order and the others are left empty
+  * @complexity O(n log(k))
+  * @param lists : sorted by `comp`, the result uses the first list's allocator
+  * @param comp
+  * @param proj
+  * @return List_
+  */
+  template <typename Compare = std::ranges::less, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Compare, std::projected<const_iterator, Proj>>
+  [[nodiscard]] static auto merge_sorted(std::span<List_> lists, Compare comp = {}, Proj proj = {}) -> List_
+  {
+    if (lists.empty()) { return List_(); }
+    List_ merged(lists.front().m_alloc);
+    //
+    using entry = std::pair<node_ptr, std::size_t>; // current head, index of its list
+    std::vector<entry> heap;
+    heap.reserve(lists.size());
+    for (std::size_t i = 0; i < lists.size(); ++i) {
+      if (!merged.can_adopt(lists[i])) {
+        List_ moved(merged.m_alloc);
+        moved.append(std::move(lists[i]));
+        lists[i].steal(moved); // same elements, now in nodes `merged` can free
+      }
+      if (!lists[i].is_empty()) { heap.emplace_back(lists[i].m_head, i); }
+      merged.m_size += lists[i].m_size;
+      merged.adopt_slabs(lists[i]);
+    }
+    // std heaps keep the greatest on top: an entry is "less" when it must come later
+    const auto later = [&comp, &proj](const entry& a, const entry& b) {
+      if (std::invoke(comp, std::invoke(proj, b.first->m_data), std::invoke(proj, a.first->m_data))) { return true; }
+      if (std::invoke(comp, std::invoke(proj, a.first->m_data), std::invoke(proj, b.first->m_data))) { return false; }
+      return a.second > b.second;
+    };
+    // what is left of each input, a throwing comparison leaves the heap unusable
+    std::vector<node_ptr> rest(lists.size());
+    for (std::size_t i = 0; i < lists.size(); ++i) { rest[i] = lists[i].m_head; }
+    //
+    node_ptr* link = &merged.m_head;
+    try {
+      std::make_heap(heap.begin(), heap.end(), later);
+      while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        auto& [node, index] = heap.back();
+        *link         = node;
+        link          = &node->m_next;
+        merged.m_tail = node;
+        rest[index]   = node->m_next;
+        if (node->m_next != nullptr && heap.size() > 1) {
+          node = node->m_next;
+          std::push_heap(heap.begin(), heap.end(), later);
+        } else if (node->m_next != nullptr) {
+          // last list standing: link the rest of it in one go
+          merged.m_tail = lists[index].m_tail;
+          rest[index]   = nullptr;
+          heap.pop_back();
+        } else {
+          heap.pop_back();
         }
       }
+    } catch (...) {
+      // the merged prefix, then the rest of every input in order, all owned by the first list
+      for (const node_ptr r : rest) {
+        if (r == nullptr) { continue; }
+        *link         = r;
+        merged.m_tail = last_of(r);
+        link          = &merged.m_tail->m_next;
+      }
+      *link = nullptr;
+      for (auto& l : lists) { l.release(); }
+      lists.front().steal(merged);
+      throw;
     }
+    for (auto& l : lists) { l.release(); }
+    return merged;
   }
 
   /**
@@ -588,11 +1575,10 @@ public:
   [[nodiscard]] constexpr auto is_sorted() const -> bool
   {
     if ( is_empty() ) [[unlikely]] { empty_list(); return -1; }
-    bool check  = false;
-    sh_ptr it   = {m_head};
+    bool check    = true;
+    node_ptr it   = {m_head};
     while ( it->m_next != nullptr ) {
-      if ( at(it->m_next) >= at(it) ) { check = true; }
-      else {
+      if ( at(it->m_next) < at(it) ) {
         check = false;
         break;
       }
@@ -639,17 +1625,19 @@ public:
   auto clear() -> void
   {
     if (is_empty()) { empty_list(); return; }
-    sh_ptr it;
-    while ( m_head != nullptr ) {
-      it = m_head->m_next;
-      m_head->m_next = nullptr;
-      m_head = it;
-    }
-    m_size = {};
+    destroy_nodes();
   }
   constexpr ~List_() {
-    clear();
+    m_max_spares = 0;
+    destroy_nodes();
+    free_spares();
   }
-}; // end of class List_<T>
+}; // end of class List_<T, Alloc>
+
+namespace pmr {
+  /* List_ whose nodes come from a std::pmr::memory_resource */
+  template <typename T>
+  using List_ = ::List_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
 
 #endif // LIST_HPP
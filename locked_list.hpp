@@ -0,0 +1,350 @@
+/**
+* @file locked_list.hpp
+* @brief a singly linked list with a mutex per node, positional mutations walk it
+*        hand over hand so writers in different regions of the list run in parallel
+*/
+
+#ifndef LOCKED_LIST_HPP
+#define LOCKED_LIST_HPP
+
+#include "list.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+/*
+* lock coupling: a walk holds the lock of the node it stands on and takes the next
+* node's lock before letting go, so it can never be overtaken and never stands on a
+* node someone unlinks. a change to the link after node `p` is made holding `p` ( and,
+* when unlinking, the victim too ). walks only ever go forward, so there is no lock
+* order cycle. the head link has its own lock in m_anchor. the allocator must be
+* thread safe.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class LockedList_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- LockedList_<T, Alloc>: Alloc::value_type must be T");
+
+  class Node;
+
+  /* the lock and link every node has, m_anchor is a bare Link in front of the first node */
+  class Link {
+  public:
+    std::mutex m_lock;
+    Node*      m_next = {nullptr};
+  }; // end of class Link
+
+  class Node : public Link {
+  public:
+    T m_data;
+    //
+    template <typename U>
+    explicit Node(U&& data) : m_data(std::forward<U>(data)) {}
+  }; // end of class Node
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+
+  template <typename U>
+  auto allocate_node(U&& arg) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    try { node_traits::construct(alloc, new_node, std::forward<U>(arg)); }
+    catch (...) { node_traits::deallocate(alloc, new_node, 1); throw; }
+    return new_node;
+  }
+
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  [[no_unique_address]] Alloc m_alloc = {};
+  Link                     m_anchor;
+  std::atomic<std::size_t> m_size = {};
+
+  /**
+  * @brief walks hand over hand to the link in front of position `pos`
+  * @complexity O(pos)
+  * @return that link, locked, or nullptr ( nothing locked ) if the list is shorter than `pos`
+  */
+  auto lock_link_before(const std::size_t pos) -> Link*
+  {
+    Link* prev = &m_anchor;
+    prev->m_lock.lock();
+    for (std::size_t i = 0; i < pos; ++i) {
+      Node* cur = prev->m_next;
+      if (cur == nullptr) { prev->m_lock.unlock(); return nullptr; }
+      cur->m_lock.lock();
+      prev->m_lock.unlock();
+      prev = cur;
+    }
+    return prev;
+  }
+
+  /**
+  * @brief walks hand over hand until `stop(cur)` holds, with both locked
+  * @complexity O(n)
+  * @return the pair, both locked, or {prev, nullptr} with only `prev` locked at the end
+  */
+  template <typename Stop>
+  auto lock_pair_where(Stop stop) -> std::pair<Link*, Node*>
+  {
+    Link* prev = &m_anchor;
+    prev->m_lock.lock();
+    Node* cur = prev->m_next;
+    while (cur != nullptr) {
+      cur->m_lock.lock();
+      if (stop(cur)) { return {prev, cur}; }
+      prev->m_lock.unlock();
+      prev = cur;
+      cur  = cur->m_next;
+    }
+    return {prev, nullptr};
+  }
+
+  /* links `new_node` after the locked `prev` and unlocks it */
+  auto link_after(Link* prev, node_ptr new_node) noexcept -> void
+  {
+    new_node->m_next = prev->m_next;
+    prev->m_next     = new_node;
+    m_size.fetch_add(1, std::memory_order_relaxed);
+    prev->m_lock.unlock();
+  }
+
+  template <typename U>
+  auto insert_at(const std::size_t pos, U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg)); // outside any lock
+    Link* prev = lock_link_before(pos);
+    if (prev == nullptr) { free_node(new_node); empty_list(); return; }
+    link_after(prev, new_node);
+  }
+
+public:
+
+  /* constructors */
+  LockedList_() = default;
+  //
+  explicit LockedList_(const Alloc& alloc)
+    : m_alloc(alloc) {}
+  //
+  explicit LockedList_(const std::initializer_list<T>& arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    for (auto it = std::rbegin(arg); it != std::rend(arg); ++it) { push_front(*it); }
+  }
+  // shared between threads by reference, never copied or moved
+  LockedList_(const LockedList_&) = delete;
+  LockedList_& operator=(const LockedList_&) = delete;
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief returns size of the list, a snapshot while other threads change it
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size.load(std::memory_order_relaxed); }
+
+  /**
+  * @brief check if list is empty, a snapshot while other threads change it
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return size() == 0; }
+
+  /**
+  * @brief returns a copy of the element at given position, references would not
+  *        survive a concurrent pop. out of range reports through empty_list() and returns
+  *        a value-initialized T{}, so calling it requires T to be value-initializable
+  * @complexity O(n)
+  * @param pos
+  * @return T
+  */
+  [[nodiscard]] auto at(const std::size_t pos) -> T
+  {
+    Link* prev = lock_link_before(pos);
+    if (prev == nullptr || prev->m_next == nullptr) {
+      if (prev != nullptr) { prev->m_lock.unlock(); }
+      empty_list(); return T{};
+    }
+    T copy = prev->m_next->m_data; // the node can not be unlinked while `prev` is held
+    prev->m_lock.unlock();
+    return copy;
+  }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_front(const T &arg) -> void { insert_at(0, arg); }
+  auto push_front(T &&arg)      -> void { insert_at(0, std::move(arg)); }
+
+  /**
+  * @brief add element at end of list, walks the whole list
+  * @complexity O(n)
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { push_at(SIZE_MAX, arg); }
+  auto push_back(T &&arg)      -> void { push_at(SIZE_MAX, std::move(arg)); }
+
+  /**
+  * @brief insert element at given position, only the two nodes around the walker are locked;
+  *        SIZE_MAX appends
+  * @complexity O(pos)
+  * @param pos
+  * @param arg
+  */
+  auto push_at(const std::size_t pos, const T &arg) -> void
+  {
+    if (pos != SIZE_MAX) { insert_at(pos, arg); return; }
+    node_ptr new_node = allocate_node(arg);
+    link_after(lock_pair_where([](Node*) { return false; }).first, new_node);
+  }
+
+  auto push_at(const std::size_t pos, T &&arg) -> void
+  {
+    if (pos != SIZE_MAX) { insert_at(pos, std::move(arg)); return; }
+    node_ptr new_node = allocate_node(std::move(arg));
+    link_after(lock_pair_where([](Node*) { return false; }).first, new_node);
+  }
+
+  /**
+  * @brief adds value after the first node holding `after`
+  * @complexity O(n)
+  * @param after : the value you want add value after it
+  * @param val : the value
+  * @return false if no node holds `after`, other threads may have just removed it
+  */
+  auto push_after(const T& after, const T& val) -> bool
+  {
+    node_ptr new_node = allocate_node(val);
+    auto [prev, cur]  = lock_pair_where([&](Node* n) { return n->m_data == after; });
+    if (cur == nullptr) { prev->m_lock.unlock(); free_node(new_node); std::cerr << "- `pos` not found..."; return false; }
+    prev->m_lock.unlock();
+    link_after(cur, new_node);
+    return true;
+  }
+
+  /**
+  * @brief pushs element before the first node holding `before`
+  * @complexity O(n)
+  * @param before the node that you wanna push before
+  * @param val the value
+  * @return false if no node holds `before`, other threads may have just removed it
+  */
+  auto push_before(const T& before, const T& val) -> bool
+  {
+    node_ptr new_node = allocate_node(val);
+    auto [prev, cur]  = lock_pair_where([&](Node* n) { return n->m_data == before; });
+    if (cur == nullptr) { prev->m_lock.unlock(); free_node(new_node); std::cerr << "- pos not found...\n"; return false; }
+    cur->m_lock.unlock();
+    link_after(prev, new_node);
+    return true;
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(pos)
+  * @return false if the list was shorter than `pos` + 1 by the time the walk got there
+  */
+  auto pop_at(const std::size_t pos) -> bool
+  {
+    Link* prev = lock_link_before(pos);
+    Node* cur  = prev != nullptr ? prev->m_next : nullptr;
+    if (cur == nullptr) {
+      if (prev != nullptr) { prev->m_lock.unlock(); }
+      empty_list(); return false;
+    }
+    // a walker still standing on `cur` holds its lock, wait for it to move on
+    cur->m_lock.lock();
+    prev->m_next = cur->m_next;
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+    cur->m_lock.unlock();
+    prev->m_lock.unlock();
+    free_node(cur);
+    return true;
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(1)
+  */
+  auto pop_front() -> bool { return pop_at(0); }
+
+  /**
+  * @brief calls `fn` on every element front to back, each under its node's lock
+  * @complexity O(n)
+  * @param fn
+  */
+  template <typename Fn>
+  auto for_each(Fn fn) -> void
+  {
+    lock_pair_where([&](Node* n) { fn(std::as_const(n->m_data)); return false; }).first->m_lock.unlock();
+  }
+
+  auto print() -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for_each([](const T& i) { std::cout << i << ' '; });
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) -> bool
+  {
+    auto [prev, cur] = lock_pair_where([&](Node* n) { return n->m_data == target; });
+    if (cur != nullptr) { cur->m_lock.unlock(); }
+    prev->m_lock.unlock();
+    return cur != nullptr;
+  }
+
+  /* no thread may be using the list any more */
+  ~LockedList_() {
+    Node* it = m_anchor.m_next;
+    while (it != nullptr) {
+      Node* next = it->m_next;
+      free_node(it);
+      it = next;
+    }
+  }
+}; // end of class LockedList_<T, Alloc>
+
+namespace pmr {
+  /* LockedList_ whose nodes come from a ( synchronized ) std::pmr::memory_resource */
+  template <typename T>
+  using LockedList_ = ::LockedList_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // LOCKED_LIST_HPP
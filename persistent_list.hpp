@@ -0,0 +1,419 @@
+/**
+* @file persistent_list.hpp
+* @brief an immutable singly linked list whose copies share structure, every copy is
+*        an O(1) snapshot that later changes to any other copy can not disturb
+*/
+
+#ifndef PERSISTENT_LIST_HPP
+#define PERSISTENT_LIST_HPP
+
+#include "list.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+/*
+* nodes are never modified once another version can reach them: operations that
+* would have to rewrite a shared node rebuild the nodes in front of it instead
+* ( path copying ) and link the copies to the untouched rest of the chain.
+* a single PersistentList_ object is not synchronized, but distinct copies may be
+* read and changed from different threads, reference counts are atomic.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class PersistentList_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- PersistentList_<T, Alloc>: Alloc::value_type must be T");
+
+  class Node;
+  using node_ptr = std::shared_ptr<Node>; // only ever read through once published
+
+  class Node {
+  public:
+    T        m_data = {};
+    node_ptr m_next = {nullptr};
+    //
+    template <typename U>
+    Node(U&& data, node_ptr next) : m_data(std::forward<U>(data)), m_next(std::move(next)) {}
+    //
+    /*
+    * drops the rest of the chain front to back while this node was its only owner,
+    * so long chains are not torn down by recursive shared_ptr destructors. the next
+    * link is copied, never moved out, so a node another version still reads is only
+    * ever touched through its reference count.
+    */
+    ~Node() {
+      node_ptr next = std::move(m_next);
+      while (next != nullptr && next.use_count() == 1) {
+        node_ptr after = next->m_next; // keeps `after` alive past the node below
+        next = std::move(after);       // frees one node, its own ~Node stops at once
+      }
+    }
+  }; // end of class Node
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  template <typename U>
+  auto make_node(U&& data, node_ptr next) const -> node_ptr
+  {
+    return std::allocate_shared<Node>(m_alloc, std::forward<U>(data), std::move(next));
+  }
+
+  /* the link that points at position `pos`, m_head for 0 */
+  [[nodiscard]] auto link_at(const std::size_t pos) const noexcept -> const node_ptr&
+  {
+    const node_ptr* link = &m_head;
+    for (std::size_t i = 0; i < pos; ++i) { link = &(*link)->m_next; }
+    return *link;
+  }
+
+  /* copies the first `count` nodes, the last copy links to `rest` */
+  auto copy_prefix(const std::size_t count, node_ptr rest) const -> node_ptr
+  {
+    if (count == 0) { return rest; }
+    node_ptr head = make_node(m_head->m_data, nullptr);
+    Node*    last = head.get();
+    const Node* it = m_head->m_next.get();
+    for (std::size_t i = 1; i < count; ++i, it = it->m_next.get()) {
+      last->m_next = make_node(it->m_data, nullptr);
+      last         = last->m_next.get();
+    }
+    last->m_next = std::move(rest);
+    return head;
+  }
+
+  /* makes `head` this version's chain and lets go of the old one */
+  auto replace_head(node_ptr head, const std::size_t size) noexcept -> void
+  {
+    m_head = std::move(head);
+    m_size = size;
+  }
+
+  node_ptr    m_head = {nullptr};
+  std::size_t m_size = {};
+  [[no_unique_address]] Alloc m_alloc = {};
+
+protected:
+  T _failed_ = {};
+
+public:
+
+  /* read-only forward iterator, valid while any version holding the node lives */
+  class const_iterator {
+  private:
+    const Node* node_ptr_ {nullptr};
+    //
+    friend class PersistentList_;
+    //
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+    //
+    constexpr const_iterator() noexcept = default;
+    constexpr const_iterator(const Node* newPtr) noexcept : node_ptr_(newPtr) {}
+    //
+    constexpr bool operator==(const const_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const const_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
+    }
+    // pre increment
+    constexpr const_iterator& operator++() noexcept {
+      node_ptr_ = node_ptr_->m_next.get();
+      return *this;
+    }
+    // post increment
+    constexpr const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      node_ptr_ = node_ptr_->m_next.get();
+      return old;
+    }
+  }; // end of class const_iterator
+
+  using iterator = const_iterator;
+
+  [[nodiscard]] auto begin()  const noexcept -> const_iterator { return const_iterator(m_head.get()); }
+  [[nodiscard]] auto end()    const noexcept -> const_iterator { return const_iterator(nullptr); }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] auto cend()   const noexcept -> const_iterator { return end(); }
+
+  /* constructors */
+  PersistentList_() noexcept = default;
+  //
+  explicit PersistentList_(const Alloc& alloc) noexcept
+    : m_alloc(alloc) {}
+  //
+  PersistentList_(const PersistentList_& lh) noexcept
+    : m_head(lh.m_head), m_size(lh.m_size), m_alloc(lh.m_alloc) {}
+  //
+  PersistentList_(PersistentList_&& lh) noexcept
+    : m_head(std::move(lh.m_head)), m_size(std::exchange(lh.m_size, 0)), m_alloc(lh.m_alloc) {}
+  //
+  explicit PersistentList_(const std::initializer_list<T>& arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    build(arg.begin(), arg.size());
+  }
+  //
+  template <typename ListAlloc>
+  explicit PersistentList_(const List_<T, ListAlloc>& lh, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    build(lh.begin(), lh.size());
+  }
+
+  //
+  PersistentList_& operator=(const PersistentList_& lh) noexcept {
+    if (this != &lh) {
+      if constexpr (std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value) {
+        m_alloc = lh.m_alloc;
+      }
+      replace_head(lh.m_head, lh.m_size);
+    }
+    return *this;
+  }
+
+  //
+  PersistentList_& operator=(PersistentList_&& lh) noexcept {
+    if (this != &lh) {
+      if constexpr (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value) {
+        m_alloc = lh.m_alloc;
+      }
+      replace_head(std::move(lh.m_head), std::exchange(lh.m_size, 0));
+    }
+    return *this;
+  }
+
+private:
+
+  /* builds the chain front to back from `count` elements starting at `first` */
+  template <typename It>
+  auto build(It first, const std::size_t count) -> void
+  {
+    if (count == 0) { return; }
+    node_ptr head = make_node(*first, nullptr);
+    Node*    last = head.get();
+    for (std::size_t i = 1; i < count; ++i) {
+      last->m_next = make_node(*++first, nullptr);
+      last         = last->m_next.get();
+    }
+    replace_head(std::move(head), count);
+  }
+
+public:
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief returns a version sharing every node with this one, same as copying
+  * @complexity O(1)
+  * @return PersistentList_
+  */
+  [[nodiscard]] auto snapshot() const noexcept -> PersistentList_ { return *this; }
+
+  /**
+  * @brief deep copies this version into a mutable List_
+  * @complexity O(n)
+  * @return List_<T, Alloc>
+  */
+  [[nodiscard]] auto to_list() const -> List_<T, Alloc>
+  {
+    List_<T, Alloc> out(m_alloc);
+    for (const auto& i : *this) { out.push_back(i); }
+    return out;
+  }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_head == nullptr; }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  * @return const T&
+  */
+  [[nodiscard]] auto front() const -> const T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_head->m_data;
+  }
+
+  /**
+  * @brief return element at given position
+  * @complexity O(n)
+  * @param pos
+  * @return const T&
+  */
+  [[nodiscard]] auto at(const std::size_t pos) const -> const T &
+  {
+    if (pos >= size()) [[unlikely]] { empty_list(); return _failed_; }
+    return link_at(pos)->m_data;
+  }
+
+  auto print() const -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for ( const auto& i : *this ) { std::cout << i << ' '; }
+  }
+
+  /**
+  * @brief add element at the beginning of this version, the old chain becomes its tail
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_front(const T &arg) -> void
+  {
+    m_head = make_node(arg, std::move(m_head));
+    ++m_size;
+  }
+
+  /**
+  * @brief add element at the beginning of this version, the old chain becomes its tail
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_front(T &&arg) -> void
+  {
+    m_head = make_node(std::move(arg), std::move(m_head));
+    ++m_size;
+  }
+
+  /**
+  * @brief insert element before position `pos`, copying the `pos` nodes in front of it
+  * @complexity O(pos)
+  * @param pos
+  * @param arg
+  */
+  auto push_at(const std::size_t pos, const T &arg) -> void
+  {
+    if (pos > size()) [[unlikely]] { empty_list(); return; }
+    if (pos == 0)                  { push_front(arg); return; }
+    node_ptr inserted = make_node(arg, link_at(pos));
+    replace_head(copy_prefix(pos, std::move(inserted)), m_size + 1);
+  }
+
+  /**
+  * @brief add element at end of this version, copies the whole chain
+  * @complexity O(n)
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { push_at(size(), arg); }
+
+  /**
+  * @brief remove first element from this version, other versions keep it
+  * @complexity O(1)
+  */
+  auto pop_front() -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    replace_head(m_head->m_next, m_size - 1);
+  }
+
+  /**
+  * @brief remove element at given position, copying the `pos` nodes in front of it
+  * @complexity O(pos)
+  * @param pos
+  */
+  auto pop_at(const std::size_t pos) -> void
+  {
+    if (pos >= size()) [[unlikely]] { empty_list(); return; }
+    if (pos == 0)                   { pop_front(); return; }
+    replace_head(copy_prefix(pos, link_at(pos)->m_next), m_size - 1);
+  }
+
+  /**
+  * @brief remove last element, copies every other node
+  * @complexity O(n)
+  */
+  auto pop_back() -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    pop_at(size() - 1);
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    for (const auto& i : *this) {
+      if ( i == target ) { return true; }
+    }
+    return false;
+  }
+
+  /**
+  * @brief returns the position of the first node containing target, or -1
+  * @complexity O(n)
+  * @param target
+  * @return std::int64_t
+  */
+  [[nodiscard]] auto locate(const T& target) const -> std::int64_t
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return -1; }
+    for (std::size_t j = 0; const auto& i : *this ) {
+      if ( i == target ) { return static_cast<std::int64_t>(j); }
+      ++j;
+    }
+    return -1;
+  }
+
+  /**
+  * @brief empties this version, nodes other versions share stay alive
+  * @complexity O(nodes only this version holds)
+  */
+  auto clear() -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    replace_head(nullptr, 0);
+  }
+
+}; // end of class PersistentList_<T, Alloc>
+
+namespace pmr {
+  /* PersistentList_ whose nodes come from a std::pmr::memory_resource */
+  template <typename T>
+  using PersistentList_ = ::PersistentList_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // PERSISTENT_LIST_HPP
@@ -0,0 +1,304 @@
+/**
+* @file rcu_list.hpp
+* @brief a singly linked list readers traverse wait-free while writers push and pop,
+*        unlinked nodes are freed through epoch based reclamation
+*/
+
+#ifndef RCU_LIST_HPP
+#define RCU_LIST_HPP
+
+#include "epoch.hpp"
+#include "list.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+/*
+* read-copy-update style: links are atomics written with release stores only by the
+* writer holding m_write, readers load them with acquire inside an epoch::guard and
+* never block or retry. a node is never modified once linked, only unlinked and
+* retired. the allocator must be thread safe.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class RcuList_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- RcuList_<T, Alloc>: Alloc::value_type must be T");
+
+  class Node {
+  public:
+    std::atomic<Node*> m_next = {nullptr};
+    T                  m_data;
+    //
+    template <typename U>
+    explicit Node(U&& data) : m_data(std::forward<U>(data)) {}
+  }; // end of class Node
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+
+  template <typename U>
+  auto allocate_node(U&& arg) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    try { node_traits::construct(alloc, new_node, std::forward<U>(arg)); }
+    catch (...) { node_traits::deallocate(alloc, new_node, 1); throw; }
+    return new_node;
+  }
+
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  struct reclaim {
+    RcuList_* m_list;
+    auto operator()(node_ptr node) const noexcept -> void { m_list->free_node(node); }
+  };
+
+  [[no_unique_address]] Alloc m_alloc = {};
+  alignas(64) std::atomic<node_ptr>    m_head = {nullptr};
+  std::atomic<std::size_t>             m_size = {};
+  alignas(64) std::mutex               m_write;
+  node_ptr                             m_tail = {nullptr}; // only touched holding m_write
+  mutable epoch::domain<Node, reclaim> m_epochs {reclaim{this}}; // readers pin through const
+
+  template <typename U>
+  auto link_front(U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    std::lock_guard lock(m_write);
+    new_node->m_next.store(m_head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_head.store(new_node, std::memory_order_release); // publishes the element too
+    if (m_tail == nullptr) { m_tail = new_node; }
+    m_size.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template <typename U>
+  auto link_back(U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    std::lock_guard lock(m_write);
+    if (m_tail == nullptr) { m_head.store(new_node, std::memory_order_release); }
+    else                   { m_tail->m_next.store(new_node, std::memory_order_release); }
+    m_tail = new_node;
+    m_size.fetch_add(1, std::memory_order_relaxed);
+  }
+
+public:
+
+  using guard = typename epoch::domain<Node, reclaim>::guard;
+
+  /* read-only forward iterator, only valid while the guard it was taken under lives */
+  class const_iterator {
+  private:
+    const Node* node_ptr_ {nullptr};
+    //
+    friend class RcuList_;
+    //
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+    //
+    constexpr const_iterator() noexcept = default;
+    constexpr const_iterator(const Node* newPtr) noexcept : node_ptr_(newPtr) {}
+    //
+    constexpr bool operator==(const const_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const const_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
+    }
+    // pre increment
+    const_iterator& operator++() noexcept {
+      node_ptr_ = node_ptr_->m_next.load(std::memory_order_acquire);
+      return *this;
+    }
+    // post increment
+    const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+  }; // end of class const_iterator
+
+  /**
+  * @brief enters a read-side section; begin()/end() and references into the list
+  *        are only valid while the returned guard lives
+  * @complexity O(1), wait-free
+  */
+  [[nodiscard]] auto pin() const noexcept -> guard { return m_epochs.pin(); }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator { return const_iterator(m_head.load(std::memory_order_acquire)); }
+  [[nodiscard]] auto end()   const noexcept -> const_iterator { return const_iterator(nullptr); }
+
+  /* constructors */
+  RcuList_() = default;
+  //
+  explicit RcuList_(const Alloc& alloc)
+    : m_alloc(alloc) {}
+  // shared between threads by reference, never copied or moved
+  RcuList_(const RcuList_&) = delete;
+  RcuList_& operator=(const RcuList_&) = delete;
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief returns size of the list, a snapshot while a writer changes it
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size.load(std::memory_order_relaxed); }
+
+  /**
+  * @brief check if list is empty, a snapshot while a writer changes it
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+  /**
+  * @brief add element at the beginning of list, serialized with other writers only
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_front(const T &arg) -> void { link_front(arg); }
+  auto push_front(T &&arg)      -> void { link_front(std::move(arg)); }
+
+  /**
+  * @brief add element at end of list, serialized with other writers only
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { link_back(arg); }
+  auto push_back(T &&arg)      -> void { link_back(std::move(arg)); }
+
+  /**
+  * @brief remove first element, readers standing on it keep it until their guard ends
+  * @complexity O(1)
+  * @return false if the list was empty
+  */
+  auto pop_front() -> bool
+  {
+    node_ptr first = {};
+    {
+      std::lock_guard lock(m_write);
+      first = m_head.load(std::memory_order_relaxed);
+      if (first == nullptr) [[unlikely]] { empty_list(); return false; }
+      m_head.store(first->m_next.load(std::memory_order_relaxed), std::memory_order_release);
+      if (m_tail == first) { m_tail = nullptr; }
+      m_size.fetch_sub(1, std::memory_order_relaxed);
+    }
+    m_epochs.retire(first);
+    return true;
+  }
+
+  /**
+  * @brief erases the list, nodes are freed once current readers are done with them
+  * @complexity O(n)
+  */
+  auto clear() -> void
+  {
+    std::lock_guard lock(m_write);
+    node_ptr it = m_head.exchange(nullptr, std::memory_order_acq_rel);
+    if (it == nullptr) { empty_list(); return; }
+    m_tail = nullptr;
+    m_size.store(0, std::memory_order_relaxed);
+    while (it != nullptr) {
+      node_ptr next = it->m_next.load(std::memory_order_relaxed);
+      m_epochs.retire(it);
+      it = next;
+    }
+  }
+
+  /**
+  * @brief returns a copy of the first element
+  * @complexity O(1), wait-free
+  * @return T
+  */
+  [[nodiscard]] auto front() const -> T
+  {
+    const guard g = pin();
+    const Node* first = m_head.load(std::memory_order_acquire);
+    if (first == nullptr) [[unlikely]] { empty_list(); return T{}; }
+    return first->m_data;
+  }
+
+  /**
+  * @brief calls `fn` on every element front to back, wait-free apart from `fn`
+  * @complexity O(n)
+  * @param fn
+  */
+  template <typename Fn>
+  auto for_each(Fn fn) const -> void
+  {
+    const guard g = pin();
+    for (const auto& i : *this) { fn(i); }
+  }
+
+  /**
+  * @brief search for a value, wait-free
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) const -> bool
+  {
+    const guard g = pin();
+    for (const auto& i : *this) {
+      if ( i == target ) { return true; }
+    }
+    return false;
+  }
+
+  /* no thread may be using the list any more */
+  ~RcuList_() {
+    node_ptr it = m_head.load(std::memory_order_relaxed);
+    while (it != nullptr) {
+      node_ptr next = it->m_next.load(std::memory_order_relaxed);
+      free_node(it);
+      it = next;
+    }
+  }
+}; // end of class RcuList_<T, Alloc>
+
+namespace pmr {
+  /* RcuList_ whose nodes come from a ( synchronized ) std::pmr::memory_resource */
+  template <typename T>
+  using RcuList_ = ::RcuList_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // RCU_LIST_HPP
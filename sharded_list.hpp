@@ -0,0 +1,114 @@
+/**
+* @file sharded_list.hpp
+* @brief a builder that gives every appending thread its own private List_ and
+*        concatenates the shards into one List_ by relinking tails to heads
+*/
+
+#ifndef SHARDED_LIST_HPP
+#define SHARDED_LIST_HPP
+
+#include "list.hpp"
+#include "thread_registry.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+/*
+* shards are indexed by reclaim::thread_index(), which no two live threads share, so
+* push_back touches only the calling thread's shard and takes no lock. each shard sits
+* on its own cache lines. combining is only valid once the appending threads are done
+* ( joined, or synchronized with otherwise ), it is not meant to race with push_back.
+* elements keep their order within a thread; shards are joined in thread index order.
+* the allocator is called from every appending thread and must be thread safe.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class ShardedList_
+{
+public:
+
+  using allocator_type = Alloc;
+  using list_type      = List_<T, Alloc>;
+
+private:
+
+  struct alignas(64) shard {
+    list_type m_list;
+    //
+    explicit shard(const Alloc& alloc) : m_list(alloc) {}
+  };
+
+  [[no_unique_address]] Alloc m_alloc = {};
+  std::vector<shard>          m_shards; // one per thread index, never reallocated
+
+public:
+
+  /* constructors */
+  ShardedList_() : ShardedList_(Alloc()) {}
+  //
+  explicit ShardedList_(const Alloc& alloc)
+    : m_alloc(alloc) {
+    m_shards.reserve(reclaim::max_threads);
+    for (std::size_t i = 0; i < reclaim::max_threads; ++i) { m_shards.emplace_back(m_alloc); }
+  }
+  // threads hold on to it by reference
+  ShardedList_(const ShardedList_&) = delete;
+  ShardedList_& operator=(const ShardedList_&) = delete;
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator every shard takes nodes from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief the calling thread's private shard, for bulk work without the per-call lookup
+  * @complexity O(1)
+  * @return list_type&
+  */
+  [[nodiscard]] auto local() -> list_type& { return m_shards[reclaim::thread_index()].m_list; }
+
+  /**
+  * @brief add element at end of the calling thread's shard, contention free
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { local().push_back(arg); }
+  auto push_back(T &&arg)      -> void { local().push_back(std::move(arg)); }
+
+  /**
+  * @brief elements over all shards, only exact once appending has stopped
+  * @complexity O(shards)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    std::size_t total = {};
+    for (std::size_t i = 0; i < reclaim::threads_seen(); ++i) { total += m_shards[i].m_list.size(); }
+    return total;
+  }
+
+  /**
+  * @brief concatenates every shard into one list by relinking, the shards are left empty
+  * @complexity O(shards), no element is copied or allocated
+  * @return list_type
+  */
+  [[nodiscard]] auto combine() -> list_type
+  {
+    list_type out(m_alloc);
+    for (std::size_t i = 0; i < reclaim::threads_seen(); ++i) { out.append(std::move(m_shards[i].m_list)); }
+    return out;
+  }
+}; // end of class ShardedList_<T, Alloc>
+
+namespace pmr {
+  /* ShardedList_ whose nodes come from a ( synchronized ) std::pmr::memory_resource */
+  template <typename T>
+  using ShardedList_ = ::ShardedList_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // SHARDED_LIST_HPP
@@ -0,0 +1,485 @@
+/**
+* @file skip_list.hpp
+* @brief a sorted singly linked list with probabilistic express lanes above the base
+*        chain: ordered insert, find, lower_bound and erase in expected O(log n)
+*/
+
+#ifndef SKIP_LIST_HPP
+#define SKIP_LIST_HPP
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+/*
+* level 0 is a plain chain through every node, ordered by Compare, and is what the
+* iterators walk. a node also sits on levels 1 .. height - 1 with probability 1/4 per
+* level, those links live in a separate lane array allocated only for nodes taller
+* than 1. next to List_'s element and next pointer every node stores the lane pointer
+* and its height ( 32 bytes against 16 for a long on 64 bit ), and the lane arrays add
+* 1/3 of a pointer per node on average, in 1 node of 4 as an allocation of its own.
+* equal elements keep their insertion order. appending an
+* element not less than back() skips the descent through the last node of every level.
+* elements are only reachable as const, changing one in place would break the order.
+*/
+template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T>>
+class SkipList_
+{
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- SkipList_<T, Compare, Alloc>: Alloc::value_type must be T");
+
+  static constexpr std::size_t max_height = 16; // 4^16 elements before the top lane thins out
+
+  class Node {
+  public:
+    T             m_data;
+    Node*         m_next   = {nullptr}; // level 0
+    Node**        m_lanes  = {nullptr}; // levels 1 .. m_height - 1, null when m_height is 1
+    std::uint8_t  m_height = {1};
+    //
+    template <typename U>
+    explicit Node(U&& data) : m_data(std::forward<U>(data)) {}
+  }; // end of class Node
+
+public:
+
+  using allocator_type = Alloc;
+  using list_type      = List_<T, Alloc>;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+  using lane_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node*>;
+  using lane_traits     = std::allocator_traits<lane_allocator>;
+
+  template <typename U>
+  auto allocate_node(U&& arg, const std::size_t height) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    try { node_traits::construct(alloc, new_node, std::forward<U>(arg)); }
+    catch (...) { node_traits::deallocate(alloc, new_node, 1); throw; }
+    if (height > 1) {
+      lane_allocator lanes(m_alloc);
+      try { new_node->m_lanes = lane_traits::allocate(lanes, height - 1); }
+      catch (...) { free_node(new_node); throw; }
+      std::fill_n(new_node->m_lanes, height - 1, nullptr);
+      new_node->m_height = static_cast<std::uint8_t>(height);
+    }
+    return new_node;
+  }
+
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    if (node->m_lanes != nullptr) {
+      lane_allocator lanes(m_alloc);
+      lane_traits::deallocate(lanes, node->m_lanes, node->m_height - 1);
+    }
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  node_ptr      m_heads[max_height] = {}; // first node of every level
+  node_ptr      m_tails[max_height] = {}; // last node of every level
+  std::size_t   m_height = {1};           // levels in use
+  std::size_t   m_size   = {};
+  std::uint64_t m_seed   = {0x9E3779B97F4A7C15};
+  [[no_unique_address]] Alloc   m_alloc = {};
+  [[no_unique_address]] Compare m_comp  = {};
+
+protected:
+  T _failed_ = {};
+
+private:
+
+  /* successor of `node` on `level`, a null node stands for the header */
+  [[nodiscard]] auto next(const Node* node, const std::size_t level) const noexcept -> node_ptr
+  {
+    if (node == nullptr) { return m_heads[level]; }
+    return level == 0 ? node->m_next : node->m_lanes[level - 1];
+  }
+
+  auto set_next(node_ptr node, const std::size_t level, node_ptr to) noexcept -> void
+  {
+    if (node == nullptr) { m_heads[level] = to; }
+    else if (level == 0) { node->m_next = to; }
+    else                 { node->m_lanes[level - 1] = to; }
+  }
+
+  /* 1 + number of coin flips coming up 1/4 in a row, xorshift64 */
+  auto random_height() noexcept -> std::size_t
+  {
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 7;
+    m_seed ^= m_seed << 17;
+    const std::uint64_t capped = m_seed | (std::uint64_t{1} << (2 * (max_height - 1)));
+    return 1 + static_cast<std::size_t>(std::countr_zero(capped)) / 2;
+  }
+
+  /*
+  * fills `update` with the last node of every level in use that comes before `key`
+  * ( null: the header ), `Upper` also steps over elements equal to `key`.
+  * returns the level 0 one
+  */
+  template <bool Upper>
+  auto descend(const T& key, node_ptr* update) const -> node_ptr
+  {
+    node_ptr prev = nullptr;
+    for (std::size_t level = m_height; level-- > 0; ) {
+      for (node_ptr it = next(prev, level); it != nullptr; it = next(prev, level)) {
+        if (Upper ? m_comp(key, it->m_data) : !m_comp(it->m_data, key)) { break; }
+        prev = it;
+      }
+      if (update != nullptr) { update[level] = prev; }
+    }
+    return prev;
+  }
+
+  /* first node not less than `key`, or null */
+  [[nodiscard]] auto lower_node(const T& key) const -> node_ptr
+  {
+    return next(descend<false>(key, nullptr), 0);
+  }
+
+  template <typename U>
+  auto link(U&& arg) -> node_ptr
+  {
+    const std::size_t height = random_height();
+    node_ptr new_node = allocate_node(std::forward<U>(arg), height);
+    node_ptr update[max_height] = {};
+    if (m_size != 0 && !m_comp(new_node->m_data, m_tails[0]->m_data)) {
+      std::copy_n(m_tails, max_height, update); // appending: every tail comes before it
+    } else {
+      descend<true>(new_node->m_data, update);
+    }
+    for (std::size_t level = 0; level < height; ++level) {
+      set_next(new_node, level, next(update[level], level));
+      set_next(update[level], level, new_node);
+      if (next(new_node, level) == nullptr) { m_tails[level] = new_node; }
+    }
+    m_height = std::max(m_height, height);
+    ++m_size;
+    return new_node;
+  }
+
+  /* unlinks `victim`, `update` holds its predecessor on each of its levels */
+  auto unlink(node_ptr victim, node_ptr const* update) noexcept -> void
+  {
+    for (std::size_t level = 0; level < victim->m_height; ++level) {
+      set_next(update[level], level, next(victim, level));
+      if (m_tails[level] == victim) { m_tails[level] = update[level]; }
+    }
+    while (m_height > 1 && m_heads[m_height - 1] == nullptr) { --m_height; }
+    free_node(victim);
+    --m_size;
+  }
+
+  auto destroy_nodes() noexcept -> void
+  {
+    node_ptr it = m_heads[0];
+    while ( it != nullptr ) {
+      node_ptr next_node = it->m_next;
+      free_node(it);
+      it = next_node;
+    }
+    std::fill_n(m_heads, max_height, nullptr);
+    std::fill_n(m_tails, max_height, nullptr);
+    m_height = 1;
+    m_size   = {};
+  }
+
+  /* takes over the nodes of `lh`, which must share the allocator */
+  auto steal(SkipList_& lh) noexcept -> void
+  {
+    std::copy_n(lh.m_heads, max_height, m_heads);
+    std::copy_n(lh.m_tails, max_height, m_tails);
+    m_height = std::exchange(lh.m_height, 1);
+    m_size   = std::exchange(lh.m_size, 0);
+    std::fill_n(lh.m_heads, max_height, nullptr);
+    std::fill_n(lh.m_tails, max_height, nullptr);
+  }
+
+public:
+
+  /* read-only forward iterator over level 0, in order */
+  class const_iterator {
+  private:
+    const Node* node_ptr_ {nullptr};
+    //
+    friend class SkipList_;
+    //
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+    //
+    constexpr const_iterator() noexcept = default;
+    constexpr const_iterator(const Node* newPtr) noexcept : node_ptr_(newPtr) {}
+    //
+    constexpr bool operator==(const const_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const const_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
+    }
+    // pre increment
+    constexpr const_iterator& operator++() noexcept {
+      node_ptr_ = node_ptr_->m_next;
+      return *this;
+    }
+    // post increment
+    constexpr const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      node_ptr_ = node_ptr_->m_next;
+      return old;
+    }
+  }; // end of class const_iterator
+
+  using iterator = const_iterator;
+
+  [[nodiscard]] auto begin()  const noexcept -> const_iterator { return const_iterator(m_heads[0]); }
+  [[nodiscard]] auto end()    const noexcept -> const_iterator { return const_iterator(nullptr); }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] auto cend()   const noexcept -> const_iterator { return end(); }
+
+  /* constructors */
+  SkipList_() = default;
+  //
+  explicit SkipList_(const Alloc& alloc, const Compare& comp = Compare())
+    : m_alloc(alloc), m_comp(comp) {}
+  //
+  SkipList_(SkipList_&& lh) noexcept
+    : m_seed(lh.m_seed), m_alloc(lh.m_alloc), m_comp(lh.m_comp) {
+    steal(lh);
+  }
+  // sorted already, every insert takes the append path
+  SkipList_(const SkipList_& lh)
+    : m_seed(lh.m_seed),
+      m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(lh.m_alloc)),
+      m_comp(lh.m_comp) {
+    for (const auto& i : lh) { link(i); }
+  }
+  //
+  explicit SkipList_(const std::initializer_list<T>& arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    for (const auto& i : arg) { link(i); }
+  }
+  // O(n) if `lh` is sorted, O(n log n) expected otherwise
+  explicit SkipList_(const list_type& lh, const Compare& comp = Compare())
+    : m_alloc(lh.get_allocator()), m_comp(comp) {
+    for (const auto& i : lh) { link(i); }
+  }
+
+  //
+  SkipList_& operator=(const SkipList_& lh) {
+    if (this != &lh) {
+      destroy_nodes();
+      m_comp = lh.m_comp; // before reinserting, so the order is the one `lh` keeps
+      for (const auto& i : lh) { link(i); }
+    }
+    return *this;
+  }
+
+  //
+  SkipList_& operator=(SkipList_&& lh) noexcept(std::allocator_traits<Alloc>::is_always_equal::value) {
+    if (this != &lh) {
+      destroy_nodes();
+      m_comp = lh.m_comp;
+      if (std::allocator_traits<Alloc>::is_always_equal::value || m_alloc == lh.m_alloc) {
+        steal(lh);
+      } else {
+        for (const auto& i : lh) { link(i); }
+        lh.destroy_nodes();
+      }
+    }
+    return *this;
+  }
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes and lanes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+  /**
+  * @brief returns the smallest element
+  * @complexity O(1)
+  * @return const T&
+  */
+  [[nodiscard]] auto front() const -> const T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_heads[0]->m_data;
+  }
+
+  /**
+  * @brief returns the largest element
+  * @complexity O(1)
+  * @return const T&
+  */
+  [[nodiscard]] auto back() const -> const T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_tails[0]->m_data;
+  }
+
+  /**
+  * @brief return element at given position
+  * @complexity O(n)
+  * @param pos
+  * @return const T&
+  */
+  [[nodiscard]] auto at(const std::size_t pos) const -> const T &
+  {
+    if (pos >= size()) [[unlikely]] { empty_list(); return _failed_; }
+    auto it = begin();
+    for (std::size_t i = 0; i < pos; ++i) { ++it; }
+    return *it;
+  }
+
+  auto print() const -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for ( const auto& i : *this ) { std::cout << i << ' '; }
+  }
+
+  /**
+  * @brief adds an element in order, after any equal ones
+  * @complexity O(log n) expected, O(1) when not less than back()
+  * @param arg
+  * @return const_iterator to the new element
+  */
+  auto insert(const T &arg) -> const_iterator { return const_iterator(link(arg)); }
+  auto insert(T &&arg)      -> const_iterator { return const_iterator(link(std::move(arg))); }
+
+  /**
+  * @brief remove the smallest element
+  * @complexity O(1)
+  */
+  auto pop_front() -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    node_ptr update[max_height] = {}; // the header precedes the first node on every level
+    unlink(m_heads[0], update);
+  }
+
+  /**
+  * @brief removes the first element equivalent to `target`
+  * @complexity O(log n) expected
+  * @param target
+  * @return false if there was none
+  */
+  auto erase(const T & target) -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    node_ptr update[max_height] = {};
+    node_ptr victim = next(descend<false>(target, update), 0);
+    if (victim == nullptr || m_comp(target, victim->m_data)) { return false; }
+    unlink(victim, update);
+    return true;
+  }
+
+  /**
+  * @brief first element not less than `target`, or end()
+  * @complexity O(log n) expected
+  * @param target
+  */
+  [[nodiscard]] auto lower_bound(const T & target) const -> const_iterator { return const_iterator(lower_node(target)); }
+
+  /**
+  * @brief first element equivalent to `target`, or end()
+  * @complexity O(log n) expected
+  * @param target
+  */
+  [[nodiscard]] auto find(const T & target) const -> const_iterator
+  {
+    const Node* node = lower_node(target);
+    if (node == nullptr || m_comp(target, node->m_data)) { return end(); }
+    return const_iterator(node);
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(log n) expected
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    return find(target) != end();
+  }
+
+  /**
+  * @brief copies the elements, in order, into a plain List_
+  * @complexity O(n)
+  * @return list_type
+  */
+  [[nodiscard]] auto to_list() const -> list_type
+  {
+    list_type out(m_alloc);
+    for (const auto& i : *this) { out.push_back(i); }
+    return out;
+  }
+
+  /**
+  * @brief erases the list
+  * @complexity O(n)
+  */
+  auto clear() -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    destroy_nodes();
+  }
+
+  ~SkipList_() {
+    destroy_nodes();
+  }
+}; // end of class SkipList_<T, Compare, Alloc>
+
+namespace pmr {
+  /* SkipList_ whose nodes and lanes come from a std::pmr::memory_resource */
+  template <typename T, typename Compare = std::less<T>>
+  using SkipList_ = ::SkipList_<T, Compare, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // SKIP_LIST_HPP
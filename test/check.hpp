@@ -0,0 +1,34 @@
+/**
+* @file check.hpp
+* @brief minimal self-checking helpers: CHECK() records failures, main returns check::result()
+*/
+
+#ifndef CHECK_HPP
+#define CHECK_HPP
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace check {
+
+  inline int failures = {};
+
+  inline auto expect(const bool ok, const char* what, const char* file, const int line) -> void
+  {
+    if (ok) { return; }
+    ++failures;
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+  }
+
+  /* exit status for main */
+  inline auto result() -> int
+  {
+    if (failures != 0) { std::fprintf(stderr, "%d check(s) failed\n", failures); }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+} // namespace check
+
+#define CHECK(cond) ::check::expect(static_cast<bool>(cond), #cond, __FILE__, __LINE__)
+
+#endif // CHECK_HPP
@@ -0,0 +1,125 @@
+/**
+* @file checkpoint_test.cpp
+* @brief List_ with use_checkpoints(): the ( position, node ) index is adjusted in place by
+*        push/pop at both ends, pop_at, emplace_at and split_at, every at() between them is
+*        checked against std::vector ( run under -DLIST_SANITIZE=address for stale nodes )
+*/
+
+#include "check.hpp"
+#include "list.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+  using list_type = List_<int>;
+
+  auto contents(const list_type& l) -> std::vector<int> { return {l.begin(), l.end()}; }
+
+  auto filled(const int count) -> list_type
+  {
+    list_type l;
+    l.use_checkpoints();
+    for (int i = 0; i < count; ++i) { l.push_back(i); }
+    return l;
+  }
+
+  /* a stride's worth of pop_front() moves the second checkpoint onto the head */
+  auto pops_past_a_checkpoint() -> void
+  {
+    {
+      list_type l = filled(64);
+      CHECK(l.at(3) == 3);
+      for (int i = 0; i < 17; ++i) { l.pop_front(); }
+      CHECK(l.at(5) == 22);
+    }
+    {
+      list_type l = filled(64);
+      CHECK(l.at(3) == 3);
+      for (int i = 0; i < 16; ++i) { l.pop_front(); }
+      l.push_front(999);
+      CHECK(l.at(0) == 999);
+      CHECK(l.at(1) == 16);
+      CHECK(l.at(40) == 55);
+    }
+    {
+      // pop_at(1) right after the pops leaves the checkpoint that reached 0 alone
+      list_type l = filled(64);
+      CHECK(l.at(20) == 20);
+      for (int i = 0; i < 15; ++i) { l.pop_front(); }
+      l.pop_at(1);
+      l.pop_front();
+      CHECK(l.at(0) == 17);
+      CHECK(l.at(30) == 47);
+    }
+  }
+
+  auto random_edits(const unsigned seed) -> void
+  {
+    std::mt19937     rng(seed);
+    list_type        l = filled(500);
+    std::vector<int> model = contents(l);
+    int  next = 500;
+    bool same = true;
+    for (int step = 0; step < 40'000 && same; ++step) {
+      const std::size_t pos = model.empty() ? 0 : rng() % model.size();
+      switch (rng() % 9) {
+        case 0:
+          l.push_front(next);
+          model.insert(model.begin(), next++);
+          break;
+        case 1:
+          l.push_back(next);
+          model.push_back(next++);
+          break;
+        case 2: // runs of pops, so later checkpoints reach the head
+          for (std::size_t i = rng() % 40; i > 0 && !model.empty(); --i) {
+            l.pop_front();
+            model.erase(model.begin());
+          }
+          break;
+        case 3:
+          if (model.empty()) { break; }
+          l.pop_back();
+          model.pop_back();
+          break;
+        case 4:
+          if (model.empty()) { break; }
+          l.pop_at(pos);
+          model.erase(model.begin() + static_cast<std::ptrdiff_t>(pos));
+          break;
+        case 5:
+          l.emplace_at(pos, next);
+          model.insert(model.begin() + static_cast<std::ptrdiff_t>(pos), next++);
+          break;
+        case 6:
+          if (model.size() > 1'000) {
+            (void)l.split_at(pos);
+            model.resize(pos);
+          }
+          break;
+        default:
+          break;
+      }
+      if (model.size() < 100) { // refill, so the index keeps several strides
+        for (int i = 0; i < 200; ++i) { l.push_back(next); model.push_back(next++); }
+      }
+      for (int reads = 0; reads < 4 && same; ++reads) {
+        const std::size_t i = rng() % model.size();
+        same = l.at(i) == model[i];
+      }
+    }
+    CHECK(same);
+    CHECK(contents(l) == model);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  pops_past_a_checkpoint();
+  for (const unsigned seed : {1U, 2U, 3U}) { random_edits(seed); }
+  return check::result();
+}
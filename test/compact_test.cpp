@@ -0,0 +1,137 @@
+/**
+* @file compact_test.cpp
+* @brief CompactList_ checked against std::vector under random positional edits, popped
+*        slots reused without growing, a stable sort, and a comparator throwing midway
+*        through sort() leaving every element linked exactly once
+*/
+
+#include "check.hpp"
+#include "compact_list.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  using list_type = CompactList_<int>;
+
+  auto contents(const list_type& l) -> std::vector<int> { return {l.begin(), l.end()}; }
+
+  auto random_edits() -> void
+  {
+    std::mt19937     rng(7);
+    list_type        l;
+    std::vector<int> model;
+    int  next = 0;
+    bool same = true;
+    for (int step = 0; step < 20'000 && same; ++step) {
+      const std::size_t pos = model.empty() ? 0 : rng() % model.size();
+      switch (rng() % 7) {
+        case 0: l.push_back(next);  model.push_back(next++); break;
+        case 1: l.push_front(next); model.insert(model.begin(), next++); break;
+        case 2:
+          l.emplace_at(pos, next);
+          model.insert(model.begin() + static_cast<std::ptrdiff_t>(pos), next++);
+          break;
+        case 3:
+          if (model.empty()) { break; }
+          l.pop_front();
+          model.erase(model.begin());
+          break;
+        case 4:
+          if (model.empty()) { break; }
+          l.pop_back();
+          model.pop_back();
+          break;
+        case 5:
+          if (model.empty()) { break; }
+          l.pop_at(pos);
+          model.erase(model.begin() + static_cast<std::ptrdiff_t>(pos));
+          break;
+        default:
+          if (model.empty()) { break; }
+          same = l.at(pos) == model[pos] && l.front() == model.front() && l.back() == model.back();
+          break;
+      }
+      same = same && l.size() == model.size();
+    }
+    CHECK(same);
+    CHECK(contents(l) == model);
+  }
+
+  /* a steady size reuses popped slots, the elements never move */
+  auto slots_reused() -> void
+  {
+    list_type l;
+    for (int i = 0; i < 100; ++i) { l.push_back(i); }
+    const std::size_t capacity = l.capacity();
+    const int*        last     = &l.back();
+    for (int i = 100; i < 10'000; ++i) { l.pop_front(); l.push_front(i); l.pop_at(50); l.push_at(50, i); }
+    CHECK(l.capacity() == capacity);
+    CHECK(&l.back() == last && l.back() == 99);
+  }
+
+  /* ties keep their order, through a projection */
+  auto stable_sort() -> void
+  {
+    std::mt19937 rng(11);
+    CompactList_<std::pair<int, int>>  l;
+    std::vector<std::pair<int, int>>   model;
+    for (int i = 0; i < 3'000; ++i) {
+      const std::pair<int, int> p = {static_cast<int>(rng() % 50), i};
+      l.push_back(p);
+      model.push_back(p);
+    }
+    l.sort(std::ranges::greater{}, &std::pair<int, int>::first);
+    std::stable_sort(model.begin(), model.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    CHECK((std::vector<std::pair<int, int>>(l.begin(), l.end()) == model));
+    list_type ints;
+    for (int i = 0; i < 1'000; ++i) { ints.push_back(static_cast<int>(rng() % 100)); }
+    ints.sort();
+    CHECK(ints.is_sorted());
+  }
+
+  /* the comparator throws after `budget` calls: no element is lost or linked twice */
+  auto throwing_sort() -> void
+  {
+    for (const int budget : {0, 1, 7, 100, 1'000, 5'000}) {
+      std::mt19937 rng(static_cast<unsigned>(budget) + 3);
+      list_type        l;
+      std::vector<int> model;
+      for (int i = 0; i < 1'500; ++i) { l.push_back(static_cast<int>(rng() % 1'000)); model.push_back(l.back()); }
+      int  calls = 0;
+      bool threw = false;
+      try {
+        l.sort([&](const int a, const int b) {
+          if (calls++ == budget) { throw std::runtime_error("comp"); }
+          return a < b;
+        });
+      } catch (const std::runtime_error&) { threw = true; }
+      CHECK(threw);
+      std::vector<int> kept = contents(l);
+      CHECK(kept.size() == l.size() && l.size() == model.size());
+      CHECK(!kept.empty() && l.back() == kept.back());
+      std::sort(kept.begin(), kept.end());
+      std::sort(model.begin(), model.end());
+      CHECK(kept == model);
+      l.push_back(-1); // the tail is linked where it should be
+      l.sort();
+      model.insert(model.begin(), -1);
+      CHECK(contents(l) == model);
+    }
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  random_edits();
+  slots_reused();
+  stable_sort();
+  throwing_sort();
+  return check::result();
+}
@@ -0,0 +1,159 @@
+/**
+* @file cursor_test.cpp
+* @brief positional at() reads interleaved with every mutator of List_: the cursor left by
+*        one read must never hand a stale node to the next, checked against std::vector
+*/
+
+#include "check.hpp"
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace {
+
+  using list_type = List_<int>;
+
+  auto contents(const list_type& l) -> std::vector<int> { return {l.begin(), l.end()}; }
+
+  auto offset(std::vector<int>& v, const std::size_t pos) { return v.begin() + static_cast<std::ptrdiff_t>(pos); }
+
+  /* ascending reads from a random position, the cursor ends up in the middle of the list */
+  auto read_from(list_type& l, const std::vector<int>& model, std::mt19937& rng) -> bool
+  {
+    if (model.empty()) { return l.size() == 0; }
+    bool same = l.size() == model.size();
+    for (std::size_t i = rng() % model.size(); same && i < model.size(); i += 1 + rng() % 4) {
+      same = l.at(i) == model[i];
+    }
+    return same;
+  }
+
+  auto interleaved(const unsigned seed) -> void
+  {
+    std::mt19937     rng(seed);
+    list_type        l;
+    std::vector<int> model;
+    int  next = 0;
+    bool same = true;
+    for (int step = 0; step < 20'000 && same; ++step) {
+      same = read_from(l, model, rng);
+      const std::size_t pos = model.empty() ? 0 : rng() % model.size();
+      switch (rng() % 16) {
+        case 0:
+          l.emplace_front(next);
+          model.insert(model.begin(), next++);
+          break;
+        case 1:
+          l.emplace_back(next);
+          model.push_back(next++);
+          break;
+        case 2:
+          l.emplace_at(pos, next);
+          model.insert(offset(model, pos), next++);
+          break;
+        case 3:
+          if (model.empty()) { break; }
+          l.emplace_after(std::next(l.cbegin(), static_cast<std::ptrdiff_t>(pos)), next);
+          model.insert(offset(model, pos + 1), next++);
+          break;
+        case 4:
+          if (model.empty()) { break; }
+          l.pop_front();
+          model.erase(model.begin());
+          break;
+        case 5:
+          if (model.empty()) { break; }
+          l.pop_back();
+          model.pop_back();
+          break;
+        case 6:
+          if (model.empty()) { break; }
+          l.pop_at(pos);
+          model.erase(offset(model, pos));
+          break;
+        case 7: { // the tail is read, then put back in front
+          list_type rest = l.split_at(pos);
+          same = same && rest.size() == model.size() - pos && (rest.size() == 0 || rest.at(rest.size() / 2) == model[pos + (model.size() - pos) / 2]);
+          l.prepend(std::move(rest));
+          std::rotate(model.begin(), offset(model, pos), model.end());
+          break;
+        }
+        case 8: { // a short chain spliced in after a node
+          if (model.empty()) { break; }
+          list_type chunk;
+          std::vector<int> added;
+          for (std::size_t i = rng() % 5 + 1; i > 0; --i) { chunk.push_back(next); added.push_back(next++); }
+          l.splice_after(std::next(l.cbegin(), static_cast<std::ptrdiff_t>(pos)), std::move(chunk));
+          model.insert(offset(model, pos + 1), added.begin(), added.end());
+          break;
+        }
+        case 9: { // sorted, read, then a sorted run merged in
+          if (model.empty()) { break; }
+          l.sort(std::ranges::less{});
+          std::sort(model.begin(), model.end());
+          same = same && read_from(l, model, rng);
+          list_type other;
+          std::vector<int> added;
+          for (std::size_t i = rng() % 8; i > 0; --i) { added.push_back(static_cast<int>(rng() % static_cast<unsigned>(next + 1))); }
+          std::sort(added.begin(), added.end());
+          for (const int x : added) { other.push_back(x); }
+          l.merge_sorted(std::move(other));
+          model.insert(model.end(), added.begin(), added.end());
+          std::stable_sort(model.begin(), model.end());
+          break;
+        }
+        case 10: {
+          const std::vector<int> added = {next, next + 1, next + 2};
+          next += 3;
+          l.insert_range_at(pos, added);
+          model.insert(offset(model, pos), added.begin(), added.end());
+          break;
+        }
+        case 11: { // every third value moves to the back
+          l.append(l.split_if([](const int x) { return x % 3 == 0; }));
+          std::stable_partition(model.begin(), model.end(), [](const int x) { return x % 3 != 0; });
+          break;
+        }
+        case 12: {
+          list_type front;
+          front.push_back(next);
+          l.prepend(std::move(front));
+          model.insert(model.begin(), next++);
+          break;
+        }
+        case 13: { // the value after an existing one
+          if (model.empty()) { break; }
+          l.push_after(int{model[pos]}, int{next});
+          model.insert(offset(model, static_cast<std::size_t>(std::find(model.begin(), model.end(), model[pos]) - model.begin()) + 1), next++);
+          break;
+        }
+        case 14: { // the value before an existing one
+          if (model.empty()) { break; }
+          l.push_before(int{model[pos]}, int{next});
+          model.insert(std::find(model.begin(), model.end(), model[pos]), next++);
+          break;
+        }
+        default: // keep the list short enough for quick reads
+          if (model.size() > 200) {
+            (void)l.split_at(model.size() / 2);
+            model.resize(model.size() / 2);
+          }
+          break;
+      }
+      same = same && read_from(l, model, rng);
+    }
+    CHECK(same);
+    CHECK(contents(l) == model);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  for (const unsigned seed : {1U, 2U, 3U}) { interleaved(seed); }
+  return check::result();
+}
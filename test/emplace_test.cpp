@@ -0,0 +1,101 @@
+/**
+* @file emplace_test.cpp
+* @brief emplace_front/back/at/after build a type that can be neither copied nor moved
+*        right inside its node, and keep positional reads, with and without checkpoints,
+*        in step with where the element landed
+*/
+
+#include "check.hpp"
+#include "list.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  /* can only ever live where it was constructed */
+  struct pinned {
+    static inline int constructed = 0;
+    int         m_key = {};
+    std::string m_name;
+    //
+    pinned() = default;
+    pinned(const int key, std::string name) : m_key(key), m_name(std::move(name)) { ++constructed; }
+    pinned(const pinned&) = delete;
+    pinned& operator=(const pinned&) = delete;
+  };
+
+  using list_type = List_<pinned>;
+
+  auto keys(const list_type& l) -> std::vector<int>
+  {
+    std::vector<int> v;
+    for (const pinned& p : l) { v.push_back(p.m_key); }
+    return v;
+  }
+
+  auto in_place() -> void
+  {
+    pinned::constructed = 0;
+    list_type l;
+    pinned& b = l.emplace_back(2, "two");
+    pinned& f = l.emplace_front(0, "zero");
+    pinned& m = l.emplace_at(1, 1, "one");
+    const auto it = l.emplace_after(std::next(l.cbegin(), 2), 3, "three");
+    CHECK(pinned::constructed == 4);
+    CHECK(keys(l) == (std::vector<int>{0, 1, 2, 3}));
+    CHECK(&l.at(0) == &f && &l.at(1) == &m && &l.at(2) == &b && &l.at(3) == &*it);
+    CHECK(l.at(1).m_name == "one" && l.back().m_name == "three");
+    l.emplace_after(l.cend(), 4, "four"); // end() appends
+    CHECK(l.back().m_key == 4 && l.size() == 5);
+  }
+
+  /* each emplace between positional reads, the reads must see it where it went */
+  auto positions(const bool checkpoints) -> void
+  {
+    list_type l;
+    if (checkpoints) { l.use_checkpoints(); }
+    std::vector<int> model;
+    for (int i = 0; i < 200; ++i) { l.emplace_back(i, "n"); model.push_back(i); }
+    int  next = 1'000;
+    bool same = true;
+    for (std::size_t round = 0; round < 300 && same; ++round) {
+      const std::size_t pos = (round * 37) % model.size();
+      same = l.at(pos).m_key == model[pos]; // leaves the cursor at `pos`
+      switch (round % 4) {
+        case 0:
+          l.emplace_front(next, "front");
+          model.insert(model.begin(), next++);
+          break;
+        case 1:
+          l.emplace_back(next, "back");
+          model.push_back(next++);
+          break;
+        case 2:
+          l.emplace_at(pos / 2, next, "at");
+          model.insert(model.begin() + static_cast<std::ptrdiff_t>(pos / 2), next++);
+          break;
+        default:
+          l.emplace_after(std::next(l.cbegin(), static_cast<std::ptrdiff_t>(pos)), next, "after");
+          model.insert(model.begin() + static_cast<std::ptrdiff_t>(pos + 1), next++);
+          break;
+      }
+      for (std::size_t i = pos; same && i < model.size(); i += 13) { same = l.at(i).m_key == model[i]; }
+      same = same && l.at(model.size() - 1).m_key == model.back();
+    }
+    CHECK(same);
+    CHECK(keys(l) == model);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  in_place();
+  positions(false);
+  positions(true);
+  return check::result();
+}
@@ -0,0 +1,60 @@
+/**
+* @file locked_list_test.cpp
+* @brief threads hammer every positional operation of LockedList_ at random, then the list
+*        is walked and compared with what the threads say they did
+*        ( configure with -DLIST_SANITIZE=thread to run it under TSan )
+*/
+
+#include "check.hpp"
+#include "locked_list.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  auto stress(const std::size_t threads) -> void
+  {
+    LockedList_<int> list;
+    for (std::size_t i = 0; i < 1'000; ++i) { list.push_back(static_cast<int>(i % 100)); }
+    std::atomic<long> inserted = {};
+    std::atomic<long> removed  = {};
+    std::atomic<long> found    = {};
+    {
+      std::vector<std::jthread> workers;
+      for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          std::mt19937 rng(static_cast<unsigned>(t) + 7);
+          for (int i = 0; i < 2'000; ++i) {
+            const int value = static_cast<int>(rng() % 100);
+            switch (rng() % 6) {
+              case 0: list.push_at(rng() % 500, value); ++inserted; break;
+              case 1: list.push_front(value);           ++inserted; break;
+              case 2: inserted += list.push_after(value, value);  break;
+              case 3: inserted += list.push_before(value, value); break;
+              case 4: removed  += list.pop_at(rng() % 500);       break;
+              default: found   += list.search(value);             break;
+            }
+          }
+        });
+      }
+    }
+    std::size_t walked = {};
+    bool        values_ok = true;
+    list.for_each([&](const int value) { ++walked; values_ok = values_ok && 0 <= value && value < 100; });
+    const auto expected = static_cast<std::size_t>(1'000 + inserted.load() - removed.load());
+    CHECK(walked == expected);
+    CHECK(list.size() == expected);
+    CHECK(values_ok);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  for (const std::size_t threads : {2, 8}) { stress(threads); }
+  return check::result();
+}
@@ -0,0 +1,112 @@
+/**
+* @file queue_test.cpp
+* @brief ConcurrentQueue_ under 4 producers and 4 consumers: every element is popped exactly
+*        once and each consumer sees the elements of one producer in push order
+*/
+
+#include "check.hpp"
+#include "concurrent_queue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t producers = 4;
+  constexpr std::size_t consumers = 4;
+  constexpr long        per_producer = 50'000;
+
+  /* producer in the high bits, sequence number in the low ones */
+  constexpr auto encode(const std::size_t producer, const long seq) -> long
+  {
+    return static_cast<long>(producer) << 32 | seq;
+  }
+
+  auto fifo_stress() -> void
+  {
+    ConcurrentQueue_<long> queue;
+    std::atomic<long>      popped = {};
+    std::atomic<bool>      go     = {false};
+    std::atomic<int>       out_of_order = {};
+    std::vector<std::atomic<int>> seen(producers * per_producer);
+    {
+      std::vector<std::jthread> threads;
+      for (std::size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          for (long i = 0; i < per_producer; ++i) {
+            while (!queue.try_push(encode(p, i))) { std::this_thread::yield(); }
+          }
+        });
+      }
+      for (std::size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+          std::vector<long> last(producers, -1);
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          long value = {};
+          while (popped.load(std::memory_order_relaxed) < static_cast<long>(producers) * per_producer) {
+            if (!queue.try_pop(value)) { (void)queue.is_empty(); std::this_thread::yield(); continue; }
+            const auto producer = static_cast<std::size_t>(value >> 32);
+            const long seq      = value & 0xffff'ffff;
+            if (seq <= last[producer]) { out_of_order.fetch_add(1, std::memory_order_relaxed); }
+            last[producer] = seq;
+            seen[producer * per_producer + static_cast<std::size_t>(seq)].fetch_add(1, std::memory_order_relaxed);
+            popped.fetch_add(1, std::memory_order_relaxed);
+          }
+        });
+      }
+      go.store(true, std::memory_order_release);
+    }
+    CHECK(out_of_order.load() == 0);
+    CHECK(queue.is_empty());
+    std::size_t wrong = {};
+    for (const auto& count : seen) { wrong += count.load() != 1; }
+    CHECK(wrong == 0);
+  }
+
+  /* a value whose move assignment throws on demand */
+  struct fragile {
+    static inline bool fail = false;
+    std::vector<int> m_payload = std::vector<int>(4);
+    fragile() = default;
+    fragile(const fragile&) = default;
+    fragile(fragile&&) = default;
+    fragile& operator=(const fragile&) = default;
+    fragile& operator=(fragile&& other)
+    {
+      if (fail) { throw std::runtime_error("fragile"); }
+      m_payload = std::move(other.m_payload);
+      return *this;
+    }
+  };
+
+  /* a throwing move loses that element, but leaks nothing and leaves the queue usable */
+  auto throwing_move() -> void
+  {
+    ConcurrentQueue_<fragile> queue;
+    CHECK(queue.try_push(fragile{}));
+    CHECK(queue.try_push(fragile{}));
+    fragile out;
+    fragile::fail = true;
+    bool threw = false;
+    try { (void)queue.try_pop(out); }
+    catch (const std::runtime_error&) { threw = true; }
+    fragile::fail = false;
+    CHECK(threw);
+    CHECK(!queue.is_empty());
+    CHECK(queue.try_pop(out));
+    CHECK(queue.is_empty());
+    CHECK(!queue.try_pop(out));
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  fifo_stress();
+  throwing_move();
+  return check::result();
+}
@@ -0,0 +1,101 @@
+/**
+* @file rcu_test.cpp
+* @brief 3 readers traverse an RcuList_ while 1 writer keeps calling push_back, pop_front
+*        and clear: every traversal must see strictly increasing values, and never a node
+*        whose element was already destroyed
+*        ( configure with -DLIST_SANITIZE=thread or address for the sanitizer runs )
+*/
+
+#include "check.hpp"
+#include "rcu_list.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t readers = 3;
+  constexpr std::size_t length  = 200;    // elements, kept steady by the writer
+  constexpr std::size_t rounds  = 20'000; // push_back/pop_front pairs of the writer
+
+  /* an element that marks itself dead when destroyed, so a reader reaching it is caught */
+  struct tagged {
+    static constexpr unsigned live = 0x11fe11feU;
+    static constexpr unsigned dead = 0xdeadbeefU;
+    long              m_value = {};
+    volatile unsigned m_tag   = live; // volatile, so the store in the destructor is not elided
+    //
+    tagged() = default;
+    explicit tagged(const long value) : m_value(value) {}
+    tagged(const tagged& other) : m_value(other.m_value) {}
+    tagged& operator=(const tagged& other) { m_value = other.m_value; return *this; }
+    ~tagged() { m_tag = dead; }
+    //
+    friend bool operator==(const tagged& a, const tagged& b) { return a.m_value == b.m_value; }
+  };
+
+  auto ordered_traversal() -> void
+  {
+    RcuList_<tagged> list;
+    for (std::size_t i = 0; i < length; ++i) { list.push_back(tagged(static_cast<long>(i))); }
+    std::atomic<std::size_t> ready        = {};
+    std::atomic<bool>        writing      = {true};
+    std::atomic<long>        out_of_order = {};
+    std::atomic<long>        freed_seen   = {};
+    std::vector<std::size_t> visited(readers);
+    {
+      std::vector<std::jthread> threads;
+      threads.emplace_back([&] {
+        while (ready.load(std::memory_order_acquire) < readers) { std::this_thread::yield(); }
+        long next = static_cast<long>(length);
+        for (std::size_t round = 1; round <= rounds; ++round) {
+          list.push_back(tagged(next++));
+          (void)list.pop_front();
+          if (round % 8 == 0) { std::this_thread::yield(); } // let readers in, even on one core
+          if (round % 100 == 0) { // empty the list now and then, readers may be standing in it
+            list.clear();
+            for (std::size_t i = 0; i < length; ++i) { list.push_back(tagged(next++)); }
+          }
+        }
+        writing.store(false, std::memory_order_release);
+      });
+      for (std::size_t r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r] {
+          ready.fetch_add(1, std::memory_order_release);
+          do {
+            long last = -1;
+            auto check_one = [&](const tagged& t) {
+              // yield inside the traversal, so the writer runs while this reader stands in the list
+              if (++visited[r] % 32 == 0) { std::this_thread::yield(); }
+              if (t.m_tag != tagged::live) { freed_seen.fetch_add(1, std::memory_order_relaxed); }
+              if (t.m_value <= last)      { out_of_order.fetch_add(1, std::memory_order_relaxed); }
+              last = t.m_value;
+            };
+            if (r == 0) { // the iterator path under an explicit guard
+              const auto g = list.pin();
+              for (const tagged& t : list) { check_one(t); }
+            } else {
+              list.for_each(check_one);
+            }
+            std::this_thread::yield();
+          } while (writing.load(std::memory_order_acquire));
+        });
+      }
+    }
+    CHECK(out_of_order.load() == 0);
+    CHECK(freed_seen.load() == 0);
+    CHECK(list.size() == length);
+    std::size_t total = {};
+    for (const std::size_t v : visited) { total += v; }
+    CHECK(total > rounds); // the readers really walked the list while it changed
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  ordered_traversal();
+  return check::result();
+}
@@ -0,0 +1,75 @@
+/**
+* @file set_test.cpp
+* @brief ConcurrentSet_ under 8 threads of random insert/erase/contains over a small key
+*        range: the successful inserts minus erases of every key must match the final contents
+*/
+
+#include "check.hpp"
+#include "concurrent_set.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t threads = 8;
+  constexpr int         keys    = 64; // few keys, so threads collide on the same nodes
+  constexpr int         ops     = 40'000;
+
+  auto net_insert_counts() -> void
+  {
+    ConcurrentSet_<int>           set;
+    std::vector<std::atomic<int>> net(keys);
+    std::atomic<bool>             go = {false};
+    {
+      std::vector<std::jthread> workers;
+      for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          std::mt19937 gen(static_cast<unsigned>(t) + 1);
+          std::uniform_int_distribution<int> key(0, keys - 1), op(0, 2);
+          while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+          for (int i = 0; i < ops; ++i) {
+            const int k = key(gen);
+            switch (op(gen)) {
+              case 0:  if (set.insert(k)) { net[k].fetch_add(1, std::memory_order_relaxed); } break;
+              case 1:  if (set.erase(k))  { net[k].fetch_sub(1, std::memory_order_relaxed); } break;
+              default: (void)set.contains(k); break;
+            }
+          }
+        });
+      }
+      go.store(true, std::memory_order_release);
+    }
+    int bad_count = {};
+    for (int k = 0; k < keys; ++k) {
+      const int n = net[k].load();
+      if ((n != 0 && n != 1) || (n == 1) != set.contains(k)) { ++bad_count; }
+    }
+    CHECK(bad_count == 0);
+  }
+
+  auto sequential() -> void
+  {
+    ConcurrentSet_<int> set;
+    CHECK(set.is_empty());
+    CHECK(set.insert(3));
+    CHECK(set.insert(1));
+    CHECK(!set.insert(3));
+    CHECK(set.contains(1) && set.contains(3) && !set.contains(2));
+    CHECK(set.erase(1));
+    CHECK(!set.erase(1));
+    CHECK(set.erase(3));
+    CHECK(set.is_empty());
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  sequential();
+  net_insert_counts();
+  return check::result();
+}
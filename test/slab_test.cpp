@@ -0,0 +1,150 @@
+/**
+* @file slab_test.cpp
+* @brief nodes of append_range() slabs moving between lists: random bulk loads, splits,
+*        appends, merges and pops checked against std::vector, then every byte handed out
+*        must have come back, also when the lists sharing a slab die on different threads
+*/
+
+#include "check.hpp"
+#include "list.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  /* bytes allocated and not deallocated yet */
+  inline std::atomic<long long> live_bytes = {};
+
+  template <typename T>
+  struct tracking_allocator {
+    using value_type = T;
+    //
+    tracking_allocator() noexcept = default;
+    template <typename U>
+    tracking_allocator(const tracking_allocator<U>&) noexcept {}
+    //
+    auto allocate(const std::size_t n) -> T*
+    {
+      live_bytes.fetch_add(static_cast<long long>(n * sizeof(T)), std::memory_order_relaxed);
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    auto deallocate(T* p, const std::size_t n) noexcept -> void
+    {
+      live_bytes.fetch_sub(static_cast<long long>(n * sizeof(T)), std::memory_order_relaxed);
+      ::operator delete(p, n * sizeof(T));
+    }
+    //
+    template <typename U>
+    friend auto operator==(const tracking_allocator&, const tracking_allocator<U>&) noexcept -> bool { return true; }
+  };
+
+  using list_type = List_<int, tracking_allocator<int>>;
+
+  auto contents(const list_type& l) -> std::vector<int> { return {l.begin(), l.end()}; }
+
+  /* a handful of lists and their expected contents, shuffled between at random */
+  auto random_moves() -> void
+  {
+    constexpr std::size_t lists = 4;
+    std::mt19937 rng(42);
+    {
+      std::vector<list_type>        l(lists);
+      std::vector<std::vector<int>> model(lists);
+      int next = 0;
+      for (int step = 0; step < 4'000; ++step) {
+        const std::size_t a = rng() % lists, b = rng() % lists;
+        switch (rng() % 8) {
+          case 0: { // bulk load
+            std::vector<int> v(rng() % 40);
+            for (auto& x : v) { x = next++; }
+            l[a].append_range(v);
+            model[a].insert(model[a].end(), v.begin(), v.end());
+            break;
+          }
+          case 1: { // split, the tail goes to b
+            if (a == b) { break; }
+            const std::size_t pos = model[a].empty() ? 0 : rng() % (model[a].size() + 1);
+            l[b].append(l[a].split_at(pos));
+            model[b].insert(model[b].end(), model[a].begin() + static_cast<std::ptrdiff_t>(pos), model[a].end());
+            model[a].resize(pos);
+            break;
+          }
+          case 2: { // split by value
+            if (a == b) { break; }
+            l[b].prepend(l[a].split_if([](const int x) { return x % 3 == 0; }));
+            std::vector<int> taken, kept;
+            for (const int x : model[a]) { (x % 3 == 0 ? taken : kept).push_back(x); }
+            taken.insert(taken.end(), model[b].begin(), model[b].end());
+            model[a] = kept;
+            model[b] = taken;
+            break;
+          }
+          case 3: { // merge two sorted lists
+            if (a == b || model[a].empty() || model[b].empty()) { break; }
+            l[a].sort();
+            l[b].sort();
+            l[a].merge_sorted(std::move(l[b]));
+            model[a].insert(model[a].end(), model[b].begin(), model[b].end());
+            std::sort(model[a].begin(), model[a].end());
+            model[b].clear();
+            break;
+          }
+          case 4: // pops free single slab nodes
+            for (std::size_t i = rng() % 20; i > 0 && !model[a].empty(); --i) {
+              l[a].pop_front();
+              model[a].erase(model[a].begin());
+            }
+            break;
+          case 5: // individually allocated nodes mixed in
+            l[a].push_back(next);
+            model[a].push_back(next++);
+            break;
+          case 6: // a move leaves the source empty
+            if (a == b) { break; }
+            l[b] = std::move(l[a]);
+            model[b] = std::move(model[a]);
+            model[a].clear();
+            break;
+          default:
+            if (rng() % 8 == 0) { l[a] = list_type(); model[a].clear(); }
+            break;
+        }
+      }
+      bool same = true;
+      for (std::size_t i = 0; i < lists; ++i) { same = same && contents(l[i]) == model[i]; }
+      CHECK(same);
+    }
+    CHECK(live_bytes.load() == 0);
+  }
+
+  /* two lists sharing each slab, freed concurrently node by node and whole */
+  auto shared_across_threads() -> void
+  {
+    for (int round = 0; round < 200; ++round) {
+      list_type left;
+      std::vector<int> v(1'000);
+      for (int i = 0; i < 1'000; ++i) { v[static_cast<std::size_t>(i)] = i; }
+      left.append_range(v);
+      left.append_range(v);
+      list_type right = left.split_at(1'500);
+      {
+        std::jthread a([&] { while (!left.is_empty())  { left.pop_front(); } });
+        std::jthread b([&] { right.clear(); }); // the whole list at once, one decrement per slab
+      }
+    }
+    CHECK(live_bytes.load() == 0);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  random_moves();
+  shared_across_threads();
+  return check::result();
+}
@@ -0,0 +1,112 @@
+/**
+* @file spare_test.cpp
+* @brief recycle_nodes(): freed nodes are handed to the next insertions without an allocator
+*        call, never more than the bound are kept, and every spare goes back to the allocator
+*        when the list dies or is moved from, counted with bench::counting_allocator
+*/
+
+#include "bench.hpp"
+#include "check.hpp"
+#include "list.hpp"
+
+#include <utility>
+
+namespace {
+
+  using list_type = List_<int, bench::counting_allocator<int>>;
+  using bench::alloc_stats;
+
+  auto push(list_type& l, const int count) -> void
+  {
+    for (int i = 0; i < count; ++i) { l.push_back(i); }
+  }
+
+  auto pop(list_type& l, const int count) -> void
+  {
+    for (int i = 0; i < count; ++i) { l.pop_front(); }
+  }
+
+  /* a steady size churning through the list allocates nothing after the first fill */
+  auto reused() -> void
+  {
+    alloc_stats::reset();
+    {
+      list_type l;
+      l.recycle_nodes(8);
+      push(l, 8);
+      CHECK(alloc_stats::calls == 8);
+      for (int round = 0; round < 100; ++round) { pop(l, 4); push(l, 4); }
+      CHECK(alloc_stats::calls == 8 && alloc_stats::frees == 0);
+      pop(l, 8); // the last pop goes through clear, which keeps the node too
+      push(l, 9);
+      CHECK(alloc_stats::calls == 9);
+    }
+    CHECK(alloc_stats::frees == alloc_stats::calls);
+  }
+
+  /* past the bound freed nodes go back at once, lowering it gives back the surplus */
+  auto bounded() -> void
+  {
+    alloc_stats::reset();
+    {
+      list_type l;
+      l.recycle_nodes(4);
+      push(l, 10);
+      pop(l, 10);
+      CHECK(alloc_stats::frees == 6);
+      push(l, 4);
+      CHECK(alloc_stats::calls == 10);
+      l.clear();
+      l.recycle_nodes(1);
+      CHECK(alloc_stats::frees == 9);
+      l.recycle_nodes(0);
+      CHECK(alloc_stats::frees == 10);
+      push(l, 1);
+      l.pop_front();
+      CHECK(alloc_stats::frees == 11); // no spares kept any more
+    }
+    CHECK(alloc_stats::frees == alloc_stats::calls);
+  }
+
+  /* spares belong to the list that freed the nodes, each is deallocated exactly once */
+  auto released() -> void
+  {
+    alloc_stats::reset();
+    {
+      list_type l;
+      l.recycle_nodes(16);
+      push(l, 16);
+      pop(l, 12);
+      CHECK(alloc_stats::frees == 0);
+    }
+    CHECK(alloc_stats::frees == 16); // the destructor gives back the 4 nodes and 12 spares
+    alloc_stats::reset();
+    {
+      list_type a;
+      a.recycle_nodes(16);
+      push(a, 16);
+      pop(a, 10);
+      list_type b(std::move(a)); // the nodes move, the spares stay behind
+      CHECK(b.size() == 6 && a.is_empty());
+      push(a, 10);
+      CHECK(alloc_stats::calls == 16); // a still reuses its own spares
+      list_type c;
+      c.recycle_nodes(16);
+      push(c, 8);
+      pop(c, 4);
+      c = std::move(b); // c's 4 nodes join its spares, b's 6 nodes arrive as they are
+      CHECK(c.size() == 6 && b.is_empty());
+      CHECK(alloc_stats::frees == 0);
+    }
+    CHECK(alloc_stats::frees == alloc_stats::calls);
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  reused();
+  bounded();
+  released();
+  return check::result();
+}
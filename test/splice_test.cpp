@@ -0,0 +1,121 @@
+/**
+* @file splice_test.cpp
+* @brief the relinking operations of List_ move nodes between lists without a single
+*        allocator call, checked with bench::counting_allocator
+*/
+
+#include "bench.hpp"
+#include "check.hpp"
+#include "list.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+  using list_type = List_<int, bench::counting_allocator<int>>;
+
+  auto filled(const int first, const int last) -> list_type
+  {
+    list_type l;
+    for (int i = first; i < last; ++i) { l.push_back(i); }
+    return l;
+  }
+
+  auto contents(const list_type& l) -> std::vector<int> { return {l.begin(), l.end()}; }
+
+  auto range(const int first, const int last) -> std::vector<int>
+  {
+    std::vector<int> v;
+    for (int i = first; i < last; ++i) { v.push_back(i); }
+    return v;
+  }
+
+  /* runs `op` and checks it made no allocation */
+  template <typename Op>
+  auto no_allocations(Op&& op) -> bool
+  {
+    bench::alloc_stats::reset();
+    op();
+    return bench::alloc_stats::calls == 0;
+  }
+
+} // namespace
+
+auto main() -> int
+{
+  {
+    list_type l = filled(0, 100);
+    list_type rest;
+    CHECK(no_allocations([&] { rest = l.split_at(40); }));
+    CHECK(contents(l) == range(0, 40));
+    CHECK(contents(rest) == range(40, 100));
+  }
+  {
+    list_type l = filled(0, 100);
+    list_type odd;
+    CHECK(no_allocations([&] { odd = l.split_if([](const int i) { return (i & 1) != 0; }); }));
+    CHECK(l.size() == 50 && odd.size() == 50);
+    CHECK(odd.front() == 1 && odd.back() == 99 && l.back() == 98);
+  }
+  {
+    // a throwing pred keeps every element here, the taken ones moved behind the rest
+    list_type l = filled(0, 10);
+    bool threw = false;
+    try {
+      (void)l.split_if([](const int i) {
+        if (i == 6) { throw std::runtime_error("pred"); }
+        return (i & 1) != 0;
+      });
+    } catch (const std::runtime_error&) { threw = true; }
+    CHECK(threw);
+    CHECK(l.size() == 10);
+    CHECK(contents(l) == (std::vector<int>{0, 2, 4, 6, 7, 8, 9, 1, 3, 5}));
+    l.push_back(10);
+    CHECK(l.back() == 10 && l.at(7) == 1);
+  }
+  {
+    list_type a = filled(0, 50);
+    list_type b = filled(50, 100);
+    CHECK(no_allocations([&] { a.append(std::move(b)); }));
+    CHECK(contents(a) == range(0, 100));
+    CHECK(b.is_empty());
+  }
+  {
+    list_type a = filled(50, 100);
+    list_type b = filled(0, 50);
+    CHECK(no_allocations([&] { a.prepend(std::move(b)); }));
+    CHECK(contents(a) == range(0, 100));
+    CHECK(b.is_empty());
+  }
+  {
+    list_type a = filled(0, 10);
+    a.pop_at(5);
+    list_type b = filled(5, 6);
+    CHECK(no_allocations([&] { a.splice_after(std::next(a.cbegin(), 4), std::move(b)); }));
+    CHECK(contents(a) == range(0, 10));
+  }
+  {
+    list_type a;
+    list_type b;
+    for (int i = 0; i < 100; i += 2) { a.push_back(i); b.push_back(i + 1); }
+    CHECK(no_allocations([&] { a.merge_sorted(std::move(b)); }));
+    CHECK(contents(a) == range(0, 100));
+  }
+  {
+    std::array<list_type, 3> lists;
+    for (int i = 0; i < 99; ++i) { lists[static_cast<std::size_t>(i % 3)].push_back(i); }
+    list_type merged;
+    CHECK(no_allocations([&] { merged = list_type::merge_sorted(lists); }));
+    CHECK(contents(merged) == range(0, 99));
+  }
+  {
+    list_type l = filled(0, 10);
+    list_type l1;
+    list_type l2;
+    CHECK(no_allocations([&] { std::move(l).split(l1, l2); }));
+    CHECK(l1.size() + l2.size() == 10);
+  }
+  return check::result();
+}
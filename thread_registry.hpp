@@ -0,0 +1,87 @@
+/**
+* @file thread_registry.hpp
+* @brief small dense per-thread indices shared by the hazard pointer and epoch
+*        reclamation domains, which keep one record per index
+*/
+
+#ifndef THREAD_REGISTRY_HPP
+#define THREAD_REGISTRY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace reclaim {
+
+  /* threads that may use the reclamation schemes at the same time */
+  inline constexpr std::size_t max_threads = 256;
+
+  namespace detail {
+
+    /* hands out small dense thread indices, an exiting thread's index is reused */
+    class thread_registry {
+    private:
+      std::mutex                 m_lock;
+      std::vector<std::uint32_t> m_free;
+      std::atomic<std::uint32_t> m_high = {}; // indices ever handed out
+      //
+    public:
+      static auto instance() -> thread_registry&
+      {
+        static thread_registry registry;
+        return registry;
+      }
+      //
+      auto acquire() -> std::uint32_t
+      {
+        std::lock_guard lock(m_lock);
+        if (!m_free.empty()) {
+          const std::uint32_t index = m_free.back();
+          m_free.pop_back();
+          return index;
+        }
+        const std::uint32_t index = m_high.load(std::memory_order_relaxed);
+        if (index == max_threads) { throw std::length_error("- reclaim: more than max_threads threads"); }
+        m_high.store(index + 1, std::memory_order_release);
+        return index;
+      }
+      //
+      auto release(const std::uint32_t index) -> void
+      {
+        std::lock_guard lock(m_lock);
+        m_free.push_back(index);
+      }
+      //
+      [[nodiscard]] auto high_water() const noexcept -> std::size_t
+      {
+        return m_high.load(std::memory_order_acquire);
+      }
+    }; // end of class thread_registry
+
+    /* owns the calling thread's index for as long as the thread lives */
+    struct thread_index_owner {
+      std::uint32_t m_index = thread_registry::instance().acquire();
+      ~thread_index_owner() { thread_registry::instance().release(m_index); }
+    };
+
+  } // namespace detail
+
+  /* the calling thread's index in [0, max_threads) */
+  inline auto thread_index() -> std::size_t
+  {
+    thread_local detail::thread_index_owner owner;
+    return owner.m_index;
+  }
+
+  /* one past the highest index handed out so far, per-thread records below it may be live */
+  inline auto threads_seen() -> std::size_t
+  {
+    return detail::thread_registry::instance().high_water();
+  }
+
+} // namespace reclaim
+
+#endif // THREAD_REGISTRY_HPP
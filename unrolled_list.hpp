@@ -0,0 +1,552 @@
+/**
+* @file unrolled_list.hpp
+* @brief a singly linked list whose nodes each hold up to `N` elements in a small
+*        contiguous array, same interface as List_
+*/
+
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N = 16, typename Alloc = std::allocator<T>>
+class UnrolledList_
+{
+  static_assert(N >= 2, "- UnrolledList_<T, N>: a node must hold at least two elements");
+  static_assert(N <= UINT32_MAX, "- UnrolledList_<T, N>: node capacity must fit in 32 bits");
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- UnrolledList_<T, N, Alloc>: Alloc::value_type must be T");
+
+  class Node {
+  public:
+    Node*         m_next  = {nullptr};
+    std::uint32_t m_count = {}; // live elements, always packed at the front
+    alignas(T) unsigned char m_storage[sizeof(T) * N];
+    //
+    [[nodiscard]] auto data() noexcept -> T* { return std::launder(reinterpret_cast<T*>(m_storage)); }
+    [[nodiscard]] auto is_full() const noexcept -> bool { return m_count == N; }
+  }; // end of class Node
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+  using value_traits    = std::allocator_traits<Alloc>;
+
+  constexpr auto allocate_node() -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    ::new (static_cast<void*>(new_node)) Node; // only the header, slots stay raw
+    return new_node;
+  }
+
+  /* destroys the node's live elements and frees it */
+  constexpr auto free_node(node_ptr node) noexcept -> void
+  {
+    for (std::uint32_t i = 0; i < node->m_count; ++i) { value_traits::destroy(m_alloc, node->data() + i); }
+    node->~Node();
+    node_allocator alloc(m_alloc);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  node_ptr    m_head = {nullptr};
+  node_ptr    m_tail = {nullptr};
+  std::size_t m_size = {};
+  [[no_unique_address]] Alloc m_alloc = {};
+
+protected:
+  T _failed_ = {};
+
+private:
+
+  /* forward iterator over (node, slot) pairs, `Const` selects const_iterator */
+  template <bool Const>
+  class basic_iterator {
+  private:
+    node_ptr      node_ptr_ {nullptr};
+    std::uint32_t index_    {};
+    //
+    friend class UnrolledList_;
+    template <bool> friend class basic_iterator;
+    //
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    constexpr basic_iterator(node_ptr newPtr, std::uint32_t index = 0) noexcept : node_ptr_(newPtr), index_(index) {}
+    // iterator -> const_iterator
+    template <bool C = Const> requires C
+    constexpr basic_iterator(const basic_iterator<false>& itr) noexcept : node_ptr_(itr.node_ptr_), index_(itr.index_) {}
+    //
+    constexpr bool operator==(const basic_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_ && index_ == itr.index_;
+    }
+    constexpr bool operator!=(const basic_iterator& itr) const noexcept {
+      return !(*this == itr);
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->data()[index_];
+    }
+    constexpr pointer operator->() const noexcept {
+      return node_ptr_->data() + index_;
+    }
+    // pre increment
+    constexpr basic_iterator& operator++() noexcept {
+      if (++index_ == node_ptr_->m_count) { node_ptr_ = node_ptr_->m_next; index_ = 0; }
+      return *this;
+    }
+    // post increment
+    constexpr basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      ++*this;
+      return old;
+    }
+  }; // end of class basic_iterator
+
+  /* frees every node, leaves the list empty */
+  constexpr auto destroy_nodes() noexcept -> void
+  {
+    while ( m_head != nullptr ) {
+      node_ptr next = m_head->m_next;
+      free_node(m_head);
+      m_head = next;
+    }
+    m_tail = nullptr;
+    m_size = {};
+  }
+
+  /* takes over `lh`'s chain, `lh` is left empty */
+  constexpr auto steal(UnrolledList_& lh) noexcept -> void
+  {
+    m_head = lh.m_head;
+    m_tail = lh.m_tail;
+    m_size = lh.m_size;
+    //
+    lh.m_head = nullptr;
+    lh.m_tail = nullptr;
+    lh.m_size = {};
+  }
+
+  /**
+  * @brief finds the node holding element `pos`, `pos` becomes the slot inside it
+  * @complexity O(n / N)
+  */
+  constexpr auto find_node(std::size_t& pos) const noexcept -> node_ptr
+  {
+    node_ptr it = m_head;
+    while (pos >= it->m_count) { pos -= it->m_count; it = it->m_next; }
+    return it;
+  }
+
+  /* links a filled node after `prev` (or at the front when `prev` is null) */
+  constexpr auto link_node_after(node_ptr prev, node_ptr new_node) noexcept -> void
+  {
+    if (prev == nullptr) { new_node->m_next = m_head; m_head = new_node; }
+    else                 { new_node->m_next = prev->m_next; prev->m_next = new_node; }
+    if (new_node->m_next == nullptr) { m_tail = new_node; }
+  }
+
+  /*
+  * a new node holding only `arg`, linked after `prev` (or at the front when `prev` is
+  * null). the node is linked once the element is built, a throwing T leaves no empty node
+  */
+  template <typename U>
+  constexpr auto push_in_new_node(node_ptr prev, U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node();
+    try { value_traits::construct(m_alloc, new_node->data(), std::forward<U>(arg)); }
+    catch (...) { free_node(new_node); throw; }
+    new_node->m_count = 1;
+    link_node_after(prev, new_node);
+    ++m_size;
+  }
+
+  /**
+  * @brief moves the upper half of a full node into a new node linked after it, nothing
+  *        is linked or destroyed until every element is in place
+  * @complexity O(N)
+  */
+  constexpr auto split_node(node_ptr node) -> node_ptr
+  {
+    node_ptr next = allocate_node();
+    const std::uint32_t keep = node->m_count / 2;
+    try {
+      for (std::uint32_t i = keep; i < node->m_count; ++i, ++next->m_count) {
+        value_traits::construct(m_alloc, next->data() + (i - keep), std::move_if_noexcept(node->data()[i]));
+      }
+    } catch (...) { free_node(next); throw; }
+    for (std::uint32_t i = keep; i < node->m_count; ++i) { value_traits::destroy(m_alloc, node->data() + i); }
+    node->m_count = keep;
+    link_node_after(node, next);
+    return next;
+  }
+
+  /* push_at() for both value categories */
+  template <typename U>
+  constexpr auto insert_at(const std::size_t pos, U&& arg) -> void
+  {
+    if (pos > size())             { empty_list(); return; }
+    if (pos == size())            { push_back(std::forward<U>(arg)); return; }
+    std::size_t slot = pos;
+    node_ptr    node = find_node(slot);
+    if (node->is_full()) {
+      node_ptr next = split_node(node);
+      if (slot > node->m_count) { slot -= node->m_count; node = next; }
+    }
+    insert_in_node(node, static_cast<std::uint32_t>(slot), std::forward<U>(arg));
+  }
+
+  /**
+  * @brief constructs `arg` at `slot` of a node that has room, shifting the rest right
+  * @complexity O(N)
+  */
+  template <typename U>
+  constexpr auto insert_in_node(node_ptr node, const std::uint32_t slot, U&& arg) -> void
+  {
+    T* data = node->data();
+    if (slot == node->m_count) {
+      value_traits::construct(m_alloc, data + slot, std::forward<U>(arg));
+    } else {
+      T value(std::forward<U>(arg)); // `arg` may alias an element about to move
+      value_traits::construct(m_alloc, data + node->m_count, std::move(data[node->m_count - 1]));
+      ++node->m_count; // counted from here on, so a throwing move leaves no element unowned
+      ++m_size;
+      std::move_backward(data + slot, data + node->m_count - 2, data + node->m_count - 1);
+      data[slot] = std::move(value);
+      return;
+    }
+    ++node->m_count;
+    ++m_size;
+  }
+
+  /**
+  * @brief removes `slot` from `node` (linked after `prev`), refilling from or
+  *        unlinking nodes so no node is left empty
+  * @complexity O(N)
+  */
+  constexpr auto erase_in_node(node_ptr prev, node_ptr node, const std::uint32_t slot) -> void
+  {
+    T* data = node->data();
+    std::move(data + slot + 1, data + node->m_count, data + slot);
+    value_traits::destroy(m_alloc, data + node->m_count - 1);
+    --node->m_count;
+    --m_size;
+    //
+    if (node->m_count == 0) {
+      if (prev == nullptr) { m_head = node->m_next; } else { prev->m_next = node->m_next; }
+      if (m_tail == node)  { m_tail = prev; }
+      free_node(node);
+      return;
+    }
+    // keep nodes at least half full by pulling the next node in when it fits
+    node_ptr next = node->m_next;
+    if (next != nullptr && node->m_count < N / 2 && node->m_count + next->m_count <= N) {
+      for (std::uint32_t i = 0; i < next->m_count; ++i) {
+        value_traits::construct(m_alloc, data + node->m_count + i, std::move(next->data()[i]));
+      }
+      node->m_count += next->m_count;
+      node->m_next   = next->m_next;
+      if (m_tail == next) { m_tail = node; }
+      free_node(next); // destroys the moved-from elements
+    }
+  }
+
+public:
+
+  using iterator        = basic_iterator<false>;
+  using const_iterator  = basic_iterator<true>;
+
+  [[nodiscard]] constexpr auto begin()        noexcept -> iterator       { return iterator(m_head); }
+  [[nodiscard]] constexpr auto end()          noexcept -> iterator       { return iterator(nullptr); }
+  [[nodiscard]] constexpr auto begin()  const noexcept -> const_iterator { return const_iterator(m_head); }
+  [[nodiscard]] constexpr auto end()    const noexcept -> const_iterator { return const_iterator(nullptr); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return const_iterator(m_head); }
+  [[nodiscard]] constexpr auto cend()   const noexcept -> const_iterator { return const_iterator(nullptr); }
+
+  /* constructors */
+  UnrolledList_() noexcept = default;
+  //
+  explicit constexpr UnrolledList_(const Alloc& alloc) noexcept
+    : m_alloc(alloc) {}
+  //
+  constexpr UnrolledList_(UnrolledList_ && lh) noexcept
+    : m_alloc(lh.m_alloc) {
+    steal(lh);
+  }
+  //
+  constexpr UnrolledList_(const UnrolledList_& lh)
+    : m_alloc(value_traits::select_on_container_copy_construction(lh.m_alloc)) {
+    for (const auto& i : lh) { push_back(i); }
+  }
+
+  //
+  template<typename ...args>
+    requires (sizeof...(args) > 0 && (std::is_convertible_v<const args&, T> && ...))
+  explicit constexpr UnrolledList_(const args& ...arg) {
+    (push_back(arg),...);
+  }
+
+  //
+  explicit constexpr UnrolledList_(const std::initializer_list<T> &arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    for (const auto &i : arg) { push_back(i); }
+  }
+
+  //
+  constexpr UnrolledList_& operator=(const UnrolledList_& lh) {
+    if (this != &lh) {
+      destroy_nodes();
+      if constexpr (value_traits::propagate_on_container_copy_assignment::value) {
+        m_alloc = lh.m_alloc;
+      }
+      for (const auto& i : lh) { push_back(i); }
+    }
+    return *this;
+  }
+
+  //
+  constexpr UnrolledList_& operator=(UnrolledList_&& lh) noexcept(
+      value_traits::propagate_on_container_move_assignment::value
+   || value_traits::is_always_equal::value) {
+    if (this != &lh) {
+      destroy_nodes();
+      if constexpr (value_traits::propagate_on_container_move_assignment::value) {
+        m_alloc = lh.m_alloc;
+        steal(lh);
+      } else {
+        if (m_alloc == lh.m_alloc) { steal(lh); }
+        else {
+          for (auto& i : lh) { push_back(std::move(i)); }
+          lh.destroy_nodes();
+        }
+      }
+    }
+    return *this;
+  }
+
+  constexpr ~UnrolledList_() {
+    destroy_nodes();
+  }
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief elements each node can hold
+  * @complexity O(1)
+  */
+  [[nodiscard]] static constexpr auto node_capacity() noexcept -> std::size_t { return N; }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr inline auto is_empty() const noexcept -> bool
+  {
+    return m_head == nullptr;
+  }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr inline auto size() const noexcept -> std::size_t { return m_size; }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr inline auto front() -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_head->data()[0];
+  }
+
+  /**
+  * @brief return last element&
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr inline auto back()  -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_;}
+    return m_tail->data()[m_tail->m_count - 1];
+  }
+
+  auto print() const -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for ( const auto& i : *this ) { std::cout << i << ' '; }
+  }
+
+  /**
+  * @brief return element at given position&
+  * @complexity O(n / N)
+  * @param times
+  */
+  [[nodiscard]] constexpr auto at(std::size_t times)  -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_;}
+    if (times >= size())         { empty_list(); return _failed_;}
+    node_ptr node = find_node(times);
+    return node->data()[times];
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1)
+  * @param arg
+  */
+  constexpr auto push_back(const T &arg) -> void
+  {
+    if (is_empty() || m_tail->is_full()) { push_in_new_node(m_tail, arg); return; }
+    insert_in_node(m_tail, m_tail->m_count, arg);
+  }
+
+  constexpr auto push_back(T &&arg) -> void
+  {
+    if (is_empty() || m_tail->is_full()) { push_in_new_node(m_tail, std::move(arg)); return; }
+    insert_in_node(m_tail, m_tail->m_count, std::move(arg));
+  }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(N)
+  * @param arg
+  */
+  constexpr auto push_front(const T &arg) -> void
+  {
+    if (is_empty() || m_head->is_full()) { push_in_new_node(nullptr, arg); return; }
+    insert_in_node(m_head, 0, arg);
+  }
+
+  constexpr auto push_front(T &&arg) -> void
+  {
+    if (is_empty() || m_head->is_full()) { push_in_new_node(nullptr, std::move(arg)); return; }
+    insert_in_node(m_head, 0, std::move(arg));
+  }
+
+  /**
+  * @brief add element at given position, a full node is split in two first
+  * @complexity O(n / N + N)
+  * @param pos
+  * @param arg
+  */
+  constexpr auto push_at(const std::size_t pos, const T &arg) -> void { insert_at(pos, arg); }
+  constexpr auto push_at(const std::size_t pos, T &&arg)      -> void { insert_at(pos, std::move(arg)); }
+
+  /**
+  * @brief remove last element
+  * @complexity O(1), O(n / N) when the tail node empties
+  */
+  auto pop_back() -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    if (m_tail->m_count > 1 || m_head == m_tail) {
+      erase_in_node(nullptr, m_tail, m_tail->m_count - 1);
+      return;
+    }
+    node_ptr prev = m_head;
+    while (prev->m_next != m_tail) { prev = prev->m_next; }
+    erase_in_node(prev, m_tail, 0);
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(N)
+  */
+  auto pop_front() -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    erase_in_node(nullptr, m_head, 0);
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(n / N + N)
+  */
+  auto pop_at(std::size_t pos) -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    if (pos >= size())            { empty_list(); return; }
+    node_ptr prev = nullptr;
+    node_ptr node = m_head;
+    while (pos >= node->m_count) { pos -= node->m_count; prev = node; node = node->m_next; }
+    erase_in_node(prev, node, static_cast<std::uint32_t>(pos));
+  }
+
+  /**
+  * @brief search for a value, scanning each node's array
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] constexpr auto search(const T & target) const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    return locate(target) != -1;
+  }
+
+  /**
+  * @brief returns the location of the first element equal to target, or -1
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] constexpr auto locate(const T& target) const -> std::int64_t
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return -1; }
+    std::size_t base = 0;
+    for (node_ptr it = m_head; it != nullptr; it = it->m_next) {
+      const T* data = it->data();
+      for (std::uint32_t i = 0; i < it->m_count; ++i) {
+        if ( data[i] == target ) { return static_cast<std::int64_t>(base + i); }
+      }
+      base += it->m_count;
+    }
+    return -1;
+  }
+
+  /**
+  * @brief erases the list
+  * @complexity O(n)
+  */
+  constexpr
+  auto clear() -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    destroy_nodes();
+  }
+}; // end of class UnrolledList_<T, N, Alloc>
+
+namespace pmr {
+  /* UnrolledList_ whose nodes come from a std::pmr::memory_resource */
+  template <typename T, std::size_t N = 16>
+  using UnrolledList_ = ::UnrolledList_<T, N, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // UNROLLED_LIST_HPP
@@ -0,0 +1,397 @@
+/**
+* @file xor_list.hpp
+* @brief a doubly traversable list whose nodes keep a single link word, the xor of
+*        the previous and next node addresses: O(1) pop_back with List_ sized nodes
+*/
+
+#ifndef XOR_LIST_HPP
+#define XOR_LIST_HPP
+
+#include "list.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+/*
+* from either end the neighbour of a node is its link xor the node we came from, so
+* walking needs two pointers ( previous, current ) instead of one, and a node can not
+* be reached or unlinked from its address alone. that rules out erase(iterator) style
+* O(1) middle edits but leaves both ends O(1) and iteration bidirectional. the links
+* are integers, nodes are only reachable through the list and its iterators, so the
+* allocator's pointer type must be a raw pointer. an iterator caches the node it came
+* from, so changing an end also invalidates the iterator standing next to it: see the
+* push and pop methods.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class XorList_
+{
+  class Node {
+  public:
+    T              m_data;
+    std::uintptr_t m_link = {}; // address of previous ^ address of next, null counts as 0
+    //
+    template <typename U>
+    explicit Node(U&& data) : m_data(std::forward<U>(data)) {}
+  }; // end of class Node
+
+  static_assert(std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+                "- XorList_<T, Alloc>: Alloc::value_type must be T");
+
+public:
+
+  using allocator_type = Alloc;
+
+private:
+
+  using node_ptr        = Node*;
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+
+  static_assert(std::is_same_v<typename node_traits::pointer, node_ptr>,
+                "- XorList_<T, Alloc>: the allocator must hand out raw pointers");
+
+  template <typename U>
+  auto allocate_node(U&& arg) -> node_ptr
+  {
+    node_allocator alloc(m_alloc);
+    node_ptr new_node = node_traits::allocate(alloc, 1);
+    try { node_traits::construct(alloc, new_node, std::forward<U>(arg)); }
+    catch (...) { node_traits::deallocate(alloc, new_node, 1); throw; }
+    return new_node;
+  }
+
+  auto free_node(node_ptr node) noexcept -> void
+  {
+    node_allocator alloc(m_alloc);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  [[nodiscard]] static auto address(const Node* node) noexcept -> std::uintptr_t
+  {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  /* the neighbour of `node` that is not `from` */
+  [[nodiscard]] static auto step(const Node* from, const Node* node) noexcept -> node_ptr
+  {
+    return reinterpret_cast<node_ptr>(node->m_link ^ address(from));
+  }
+
+  node_ptr    m_head = {nullptr};
+  node_ptr    m_tail = {nullptr};
+  std::size_t m_size = {};
+  [[no_unique_address]] Alloc m_alloc = {};
+
+protected:
+  T _failed_ = {};
+
+private:
+
+  /* links a new node outside `end`, which is m_head or m_tail, the other end is `far` */
+  template <typename U>
+  auto link_end(node_ptr& end, node_ptr& far, U&& arg) -> void
+  {
+    node_ptr new_node = allocate_node(std::forward<U>(arg));
+    new_node->m_link  = address(end); // the other neighbour is null
+    if (end != nullptr) { end->m_link ^= address(new_node); }
+    else                { far = new_node; }
+    end = new_node;
+    ++m_size;
+  }
+
+  /* frees the node at `end`, which is m_head or m_tail, the other end is `far` */
+  auto unlink_end(node_ptr& end, node_ptr& far) noexcept -> void
+  {
+    node_ptr victim = end;
+    end = step(nullptr, victim);
+    if (end != nullptr) { end->m_link ^= address(victim); }
+    else                { far = nullptr; }
+    free_node(victim);
+    --m_size;
+  }
+
+  auto destroy_nodes() noexcept -> void
+  {
+    node_ptr prev = nullptr;
+    while ( m_head != nullptr ) {
+      node_ptr next = step(prev, m_head);
+      prev = m_head;
+      free_node(m_head);
+      m_head = next;
+    }
+    m_tail = nullptr;
+    m_size = {};
+  }
+
+  /* takes over `lh`'s chain, `lh` is left empty */
+  auto steal(XorList_& lh) noexcept -> void
+  {
+    m_head = std::exchange(lh.m_head, nullptr);
+    m_tail = std::exchange(lh.m_tail, nullptr);
+    m_size = std::exchange(lh.m_size, 0);
+  }
+
+  /* bidirectional iterator, carries the node it came from to decode the next link */
+  template <bool Const>
+  class basic_iterator {
+  private:
+    node_ptr prev_ {nullptr};
+    node_ptr node_ptr_ {nullptr};
+    //
+    friend class XorList_;
+    template <bool> friend class basic_iterator;
+    //
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    constexpr basic_iterator(node_ptr prev, node_ptr node) noexcept : prev_(prev), node_ptr_(node) {}
+    // iterator -> const_iterator
+    template <bool C = Const> requires C
+    constexpr basic_iterator(const basic_iterator<false>& itr) noexcept : prev_(itr.prev_), node_ptr_(itr.node_ptr_) {}
+    //
+    constexpr bool operator==(const basic_iterator& itr) const noexcept {
+      return node_ptr_ == itr.node_ptr_;
+    }
+    constexpr bool operator!=(const basic_iterator& itr) const noexcept {
+      return node_ptr_ != itr.node_ptr_;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr_->m_data;
+    }
+    constexpr pointer operator->() const noexcept {
+      return &node_ptr_->m_data;
+    }
+    // pre increment
+    basic_iterator& operator++() noexcept {
+      node_ptr next = step(prev_, node_ptr_);
+      prev_     = node_ptr_;
+      node_ptr_ = next;
+      return *this;
+    }
+    // post increment
+    basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    // pre decrement, end() steps back onto the tail
+    basic_iterator& operator--() noexcept {
+      node_ptr before = step(node_ptr_, prev_);
+      node_ptr_ = prev_;
+      prev_     = before;
+      return *this;
+    }
+    // post decrement
+    basic_iterator operator--(int) noexcept {
+      basic_iterator old = *this;
+      --*this;
+      return old;
+    }
+  }; // end of class basic_iterator
+
+public:
+
+  using iterator               = basic_iterator<false>;
+  using const_iterator         = basic_iterator<true>;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  [[nodiscard]] auto begin()        noexcept -> iterator       { return iterator(nullptr, m_head); }
+  [[nodiscard]] auto end()          noexcept -> iterator       { return iterator(m_tail, nullptr); }
+  [[nodiscard]] auto begin()  const noexcept -> const_iterator { return const_iterator(nullptr, m_head); }
+  [[nodiscard]] auto end()    const noexcept -> const_iterator { return const_iterator(m_tail, nullptr); }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] auto cend()   const noexcept -> const_iterator { return end(); }
+  [[nodiscard]] auto rbegin()       noexcept -> reverse_iterator       { return reverse_iterator(end()); }
+  [[nodiscard]] auto rend()         noexcept -> reverse_iterator       { return reverse_iterator(begin()); }
+  [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  [[nodiscard]] auto rend()   const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+  /* constructors */
+  XorList_() noexcept = default;
+  //
+  explicit XorList_(const Alloc& alloc) noexcept
+    : m_alloc(alloc) {}
+  //
+  XorList_(XorList_&& lh) noexcept
+    : m_alloc(lh.m_alloc) {
+    steal(lh);
+  }
+  //
+  XorList_(const XorList_& lh)
+    : m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(lh.m_alloc)) {
+    for (const auto& i : lh) { push_back(i); }
+  }
+  //
+  explicit XorList_(const std::initializer_list<T>& arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    for (const auto& i : arg) { push_back(i); }
+  }
+
+  //
+  XorList_& operator=(const XorList_& lh) {
+    if (this != &lh) {
+      destroy_nodes();
+      for (const auto& i : lh) { push_back(i); }
+    }
+    return *this;
+  }
+
+  //
+  XorList_& operator=(XorList_&& lh) noexcept(std::allocator_traits<Alloc>::is_always_equal::value) {
+    if (this != &lh) {
+      destroy_nodes();
+      if (std::allocator_traits<Alloc>::is_always_equal::value || m_alloc == lh.m_alloc) { steal(lh); }
+      else {
+        for (auto& i : lh) { push_back(std::move(i)); }
+        lh.destroy_nodes();
+      }
+    }
+    return *this;
+  }
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator nodes are taken from
+  * @complexity O(1)
+  * @return allocator_type
+  */
+  [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_head == nullptr; }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]] auto front() -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_head->m_data;
+  }
+
+  /**
+  * @brief return last element&
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]] auto back() -> T &
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return _failed_; }
+    return m_tail->m_data;
+  }
+
+  auto print() const -> void
+  {
+    if (is_empty()) [[unlikely]]  { empty_list(); return; }
+    for ( const auto& i : *this ) { std::cout << i << ' '; }
+  }
+
+  /**
+  * @brief add element at end of list. invalidates end() and rbegin(), they cache the old
+  *        tail as the node before them; iterators to elements stay valid
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_back(const T &arg) -> void { link_end(m_tail, m_head, arg); }
+  auto push_back(T &&arg)      -> void { link_end(m_tail, m_head, std::move(arg)); }
+
+  /**
+  * @brief add element at the beginning of list. invalidates iterators to the old first
+  *        element ( begin(), rend() ), they cache a null node before it; others stay valid
+  * @complexity O(1)
+  * @param arg
+  */
+  auto push_front(const T &arg) -> void { link_end(m_head, m_tail, arg); }
+  auto push_front(T &&arg)      -> void { link_end(m_head, m_tail, std::move(arg)); }
+
+  /**
+  * @brief remove last element, invalidates iterators to it and to end() / rbegin()
+  * @complexity O(1)
+  */
+  auto pop_back() -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    unlink_end(m_tail, m_head);
+  }
+
+  /**
+  * @brief remove first element, invalidates iterators to it and to the new first element
+  * @complexity O(1)
+  */
+  auto pop_front() -> void
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return; }
+    unlink_end(m_head, m_tail);
+  }
+
+  /**
+  * @brief reverses the order of the elements, the links read the same both ways
+  * @complexity O(1)
+  */
+  auto reverse() noexcept -> void { std::swap(m_head, m_tail); }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]] auto search(const T & target) const -> bool
+  {
+    if (is_empty()) [[unlikely]] { empty_list(); return false; }
+    for (const auto& i : *this) {
+      if ( i == target ) { return true; }
+    }
+    return false;
+  }
+
+  /**
+  * @brief erases the list
+  * @complexity O(n)
+  */
+  auto clear() -> void
+  {
+    if (is_empty()) { empty_list(); return; }
+    destroy_nodes();
+  }
+
+  ~XorList_() {
+    destroy_nodes();
+  }
+}; // end of class XorList_<T, Alloc>
+
+namespace pmr {
+  /* XorList_ whose nodes come from a std::pmr::memory_resource */
+  template <typename T>
+  using XorList_ = ::XorList_<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
+#endif // XOR_LIST_HPP